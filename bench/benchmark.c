@@ -0,0 +1,205 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * Benchmark del compilador. Para cada forma de contrato genera entradas de
+ * tamaño creciente (con "ContractGenerator"), las compila con el ejecutable
+ * "Compiler" y reporta el throughput (líneas por segundo) y el pico de memoria
+ * residente (RSS) de cada compilación:
+ *
+ *	Benchmark <compiler> <generator> [-s scale] [-r repetitions]
+ *
+ * Cada tamaño duplica al anterior. Si el compilador escala linealmente, el
+ * throughput se mantiene; si cae a menos de la mitad entre el tamaño más chico
+ * y el más grande, la forma se informa como peor que lineal y el benchmark
+ * termina con error.
+ */
+
+#define SIZE_STEPS 4
+#define MIN_SCALING 0.5
+
+typedef struct {
+	const char *name;
+
+	// Tamaño del primer paso (se duplica en cada paso)
+	long baseSize;
+} BenchmarkShape;
+
+static const BenchmarkShape SHAPES[] = {
+	{ "functions", 1000 },
+	{ "expressions", 500 },
+	{ "sums", 50000 }, // 400000 términos en el paso más grande, más de lo que permite una recursión por término
+	{ "instructions", 4000 },
+	{ "state-variables", 4000 },
+	{ "builtins", 4000 }
+};
+
+#define SHAPE_COUNT (sizeof(SHAPES) / sizeof(BenchmarkShape))
+
+typedef struct {
+	int status;
+	double seconds;
+	long peakResidentKilobytes;
+} ProcessMeasure;
+
+static double monotonicSeconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/**
+ * Runs "arguments" with its stdout redirected to "outFileName" (and stderr to
+ * /dev/null), and measures it. The peak RSS is that of the child alone.
+ */
+static ProcessMeasure run(char *const arguments[], const char *outFileName) {
+	ProcessMeasure measure = { -1, 0, 0 };
+	const double start = monotonicSeconds();
+
+	pid_t child = fork();
+	if (child < 0) {
+		perror("Error starting process");
+		return measure;
+	}
+	if (child == 0) {
+		int out = open(outFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		int null = open("/dev/null", O_WRONLY);
+		if (out < 0 || null < 0) _exit(127);
+		dup2(out, STDOUT_FILENO);
+		dup2(null, STDERR_FILENO);
+		execv(arguments[0], arguments);
+		_exit(127);
+	}
+
+	int status;
+	struct rusage usage;
+	if (wait4(child, &status, 0, &usage) < 0) {
+		perror("Error waiting for process");
+		return measure;
+	}
+	measure.seconds = monotonicSeconds() - start;
+	measure.status = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+	measure.peakResidentKilobytes = usage.ru_maxrss;
+	return measure;
+}
+
+static long countLines(const char *fileName) {
+	FILE *file = fopen(fileName, "r");
+	if (file == NULL) return 0;
+	long lines = 0;
+	int c;
+	while ((c = getc_unlocked(file)) != EOF) {
+		if (c == '\n') ++lines;
+	}
+	fclose(file);
+	return lines;
+}
+
+static void printUsage(FILE *out, const char *program) {
+	fprintf(out, "Usage: %s <compiler> <generator> [-s scale] [-r repetitions]\n", program);
+}
+
+int main(int argumentCount, char *arguments[]) {
+	double scale = 1;
+	int repetitions = 3;
+	int opt;
+	while ((opt = getopt(argumentCount, arguments, "s:r:h")) != -1) {
+		switch (opt) {
+			case 's':
+				scale = atof(optarg);
+				break;
+			case 'r':
+				repetitions = atoi(optarg);
+				break;
+			case 'h':
+				printUsage(stdout, arguments[0]);
+				return EXIT_SUCCESS;
+			default:
+				printUsage(stderr, arguments[0]);
+				return EXIT_FAILURE;
+		}
+	}
+	if (argumentCount - optind != 2 || scale <= 0 || repetitions <= 0) {
+		printUsage(stderr, arguments[0]);
+		return EXIT_FAILURE;
+	}
+	char *compiler = arguments[optind];
+	char *generator = arguments[optind + 1];
+
+	char directory[] = "/tmp/soliditish-bench-XXXXXX";
+	if (mkdtemp(directory) == NULL) {
+		perror("Error creating benchmark directory");
+		return EXIT_FAILURE;
+	}
+	char inFileName[sizeof(directory) + 32];
+	char outFileName[sizeof(directory) + 32];
+	char logFileName[sizeof(directory) + 32];
+	snprintf(inFileName, sizeof(inFileName), "%s/contract", directory);
+	snprintf(outFileName, sizeof(outFileName), "%s/contract.sol", directory);
+	snprintf(logFileName, sizeof(logFileName), "%s/compiler.log", directory);
+
+	printf("%-16s %10s %10s %10s %14s %14s\n", "shape", "size", "lines", "seconds", "lines/sec", "peak RSS (KB)");
+
+	int failures = 0;
+	for (size_t i = 0; i < SHAPE_COUNT; ++i) {
+		double throughput[SIZE_STEPS];
+		int failed = 0;
+
+		for (int step = 0; step < SIZE_STEPS; ++step) {
+			char size[32];
+			snprintf(size, sizeof(size), "%ld", (long) (SHAPES[i].baseSize * scale) << step);
+
+			char *generatorArguments[] = { generator, (char *) SHAPES[i].name, size, NULL };
+			if (run(generatorArguments, inFileName).status != 0) {
+				fprintf(stderr, "Error generating the '%s' contract.\n", SHAPES[i].name);
+				return EXIT_FAILURE;
+			}
+			const long lines = countLines(inFileName);
+
+			// The fastest run is the least disturbed by the rest of the system
+			ProcessMeasure best = { 0, -1, 0 };
+			char *compilerArguments[] = { compiler, inFileName, "-o", outFileName, NULL };
+			for (int r = 0; r < repetitions; ++r) {
+				ProcessMeasure measure = run(compilerArguments, logFileName);
+				if (measure.status != 0) {
+					best = measure;
+					break;
+				}
+				if (best.seconds < 0 || measure.seconds < best.seconds) best.seconds = measure.seconds;
+				if (measure.peakResidentKilobytes > best.peakResidentKilobytes) best.peakResidentKilobytes = measure.peakResidentKilobytes;
+			}
+
+			if (best.status != 0) {
+				printf("%-16s %10s %10ld %10s %14s %14s  (compiler exited with status %d)\n", SHAPES[i].name, size, lines, "-", "-", "-", best.status);
+				failed = 1;
+				break;
+			}
+			throughput[step] = lines / best.seconds;
+			printf("%-16s %10s %10ld %10.4f %14.0f %14ld\n", SHAPES[i].name, size, lines, best.seconds, throughput[step], best.peakResidentKilobytes);
+		}
+
+		if (!failed) {
+			const double scaling = throughput[SIZE_STEPS - 1] / throughput[0];
+			if (scaling < MIN_SCALING) {
+				printf("%-16s worse than linear: throughput x%.2f from the smallest to the largest size\n", SHAPES[i].name, scaling);
+				failed = 1;
+			}
+		}
+		failures += failed;
+	}
+
+	unlink(inFileName);
+	unlink(outFileName);
+	unlink(logFileName);
+	rmdir(directory);
+
+	if (failures > 0) printf("\n%d shape(s) failed.\n", failures);
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
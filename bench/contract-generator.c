@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Generador de contratos Soliditish sintéticos, para el benchmark del
+ * compilador. Escribe en stdout un contrato válido con la forma y el tamaño
+ * pedidos:
+ *
+ *	ContractGenerator <shape> <size>
+ *
+ * Cada forma estresa una parte distinta del compilador, y su tamaño crece de
+ * manera lineal con "size" (la cantidad de líneas es aproximadamente
+ * proporcional). Todos los identificadores son únicos en el contrato, de modo
+ * que las entradas son válidas aún para versiones del compilador sin scopes.
+ */
+
+#define ADDRESS "0x24862BDE3581a23552CE4EE712614550d7aE49FC"
+
+typedef void (*ShapeGenerator)(FILE *out, long size);
+
+typedef struct {
+	const char *name;
+	const char *description;
+	ShapeGenerator generate;
+} Shape;
+
+// "size" funciones públicas con parámetros, variables locales y un condicional.
+static void generateFunctions(FILE *out, long size) {
+	for (long i = 0; i < size; ++i) {
+		fprintf(out, "    @public\n");
+		fprintf(out, "    function function%ld(uint amount%ld, address to%ld) {\n", i, i, i);
+		fprintf(out, "        uint total%ld = amount%ld * 2 + 1;\n", i, i);
+		fprintf(out, "        if (total%ld > 10) {\n", i);
+		fprintf(out, "            total%ld -= 10;\n", i);
+		fprintf(out, "        }\n");
+		fprintf(out, "    }\n\n");
+	}
+}
+
+// Una expresión con "size" niveles de paréntesis anidados, un operando por línea.
+static void generateExpressions(FILE *out, long size) {
+	fprintf(out, "    uint deep = ");
+	for (long i = 0; i < size; ++i) fputc('(', out);
+	fprintf(out, "1\n");
+	for (long i = 0; i < size; ++i) {
+		// Alternates + and % so that the value stays small
+		if (i % 2 == 0) fprintf(out, "        + %ld)\n", i % 97);
+		else fprintf(out, "        %% %ld)\n", 2 + i % 89);
+	}
+	fprintf(out, "    ;\n");
+}
+
+// Una suma plana de "size" términos (x + x + ...), que el parser asocia a la
+// izquierda en un árbol de "size" niveles. No es constante, así que no se pliega.
+static void generateSums(FILE *out, long size) {
+	fprintf(out, "    function sum(uint x) {\n");
+	fprintf(out, "        uint total = x");
+	for (long i = 1; i < size; ++i) fprintf(out, i % 16 == 0 ? "\n            + x" : " + x");
+	fprintf(out, ";\n");
+	fprintf(out, "    }\n");
+}
+
+// Una función con "size" instrucciones de todo tipo.
+static void generateInstructions(FILE *out, long size) {
+	fprintf(out, "    function instructions(uint limit) {\n");
+	fprintf(out, "        uint counter = 0;\n");
+	for (long i = 0; i < size; ++i) {
+		switch (i % 6) {
+			case 0:
+				fprintf(out, "        uint value%ld = %ld * limit + counter;\n", i, i);
+				break;
+			case 1:
+				fprintf(out, "        counter = counter + %ld;\n", i);
+				break;
+			case 2:
+				fprintf(out, "        counter += limit %% %ld;\n", 2 + i % 13);
+				break;
+			case 3:
+				fprintf(out, "        if (counter >= limit) { counter = 0; } else { counter++; }\n");
+				break;
+			case 4:
+				fprintf(out, "        for (uint index%ld = 0; index%ld < limit; index%ld++) { counter += index%ld; }\n", i, i, i, i);
+				break;
+			case 5:
+				fprintf(out, "        bool flag%ld = (counter > limit) && !(counter == %ld);\n", i, i);
+				break;
+		}
+	}
+	fprintf(out, "    }\n");
+}
+
+// "size" variables de estado, de todos los tipos.
+static void generateStateVariables(FILE *out, long size) {
+	for (long i = 0; i < size; ++i) {
+		switch (i % 7) {
+			case 0: fprintf(out, "    uint supply%ld = %ld;\n", i, i); break;
+			case 1: fprintf(out, "    int balance%ld = %ld;\n", i, i); break;
+			case 2: fprintf(out, "    bool enabled%ld = true;\n", i); break;
+			case 3: fprintf(out, "    address owner%ld = " ADDRESS ";\n", i); break;
+			case 4: fprintf(out, "    ERC20 token%ld = " ADDRESS ";\n", i); break;
+			case 5: fprintf(out, "    string name%ld = \"Token %ld\";\n", i, i); break;
+			case 6: fprintf(out, "    @public\n    uint[%ld] values%ld;\n", 1 + i % 16, i); break;
+		}
+	}
+}
+
+// Una función con "size" llamadas a funciones built-in (y a miembros de tokens).
+static void generateBuiltins(FILE *out, long size) {
+	fprintf(out, "    ERC20 token = " ADDRESS ";\n");
+	fprintf(out, "    ERC721 collection = " ADDRESS ";\n\n");
+	fprintf(out, "    @public\n");
+	fprintf(out, "    function builtins(address to, uint amount) {\n");
+	for (long i = 0; i < size; ++i) {
+		switch (i % 5) {
+			case 0: fprintf(out, "        log(\"Step %ld:\", amount);\n", i); break;
+			case 1: fprintf(out, "        uint balance%ld = balance(to);\n", i); break;
+			case 2: fprintf(out, "        transferEth(to, 1e18);\n"); break;
+			case 3: fprintf(out, "        address clone%ld = createProxyTo(collection);\n", i); break;
+			case 4: fprintf(out, "        token.transfer(to, amount);\n"); break;
+		}
+	}
+	fprintf(out, "    }\n");
+}
+
+static const Shape SHAPES[] = {
+	{ "functions", "many small functions", generateFunctions },
+	{ "expressions", "one deeply nested expression", generateExpressions },
+	{ "sums", "one long flat sum of terms", generateSums },
+	{ "instructions", "one long list of instructions", generateInstructions },
+	{ "state-variables", "many state variables", generateStateVariables },
+	{ "builtins", "heavy use of built-in functions", generateBuiltins }
+};
+
+#define SHAPE_COUNT (sizeof(SHAPES) / sizeof(Shape))
+
+static void printUsage(FILE *out, const char *program) {
+	fprintf(out, "Usage: %s <shape> <size>\n\nShapes:\n", program);
+	for (size_t i = 0; i < SHAPE_COUNT; ++i) fprintf(out, "  %-16s %s\n", SHAPES[i].name, SHAPES[i].description);
+}
+
+int main(int argumentCount, char *arguments[]) {
+	if (argumentCount != 3) {
+		printUsage(stderr, arguments[0]);
+		return EXIT_FAILURE;
+	}
+
+	const long size = atol(arguments[2]);
+	for (size_t i = 0; i < SHAPE_COUNT; ++i) {
+		if (strcmp(SHAPES[i].name, arguments[1]) != 0) continue;
+		printf("contract Benchmark {\n\n");
+		SHAPES[i].generate(stdout, size < 0 ? 0 : size);
+		printf("\n}\n");
+		return EXIT_SUCCESS;
+	}
+
+	fprintf(stderr, "Unknown shape: '%s'.\n", arguments[1]);
+	printUsage(stderr, arguments[0]);
+	return EXIT_FAILURE;
+}
@@ -5,5 +5,17 @@ ROOT="$(dirname "$0")"
 
 cd "$ROOT/.."
 
-# Manda por stdin el contenido del archivo al compilador
-cat "$1" | ./bin/Compiler "$2" "$3" "$4" "$5" "$6" "$7" "$8" "$9"
+# Si $SOLIDITISH_CACHE_DIR está definida, se reutilizan las compilaciones
+# guardadas allí (ver "Compiler --cache-dir").
+if [ -n "$SOLIDITISH_CACHE_DIR" ]; then
+	set -- --cache-dir "$SOLIDITISH_CACHE_DIR" "$@"
+fi
+
+# Si hay un servidor del compilador escuchando en $SOLIDITISH_SOCKET (ver
+# "Compiler --serve"), se le delega la compilación en lugar de iniciar una.
+if [ -n "$SOLIDITISH_SOCKET" ] && [ -S "$SOLIDITISH_SOCKET" ]; then
+	exec ./bin/Compiler --connect "$SOLIDITISH_SOCKET" "$@"
+fi
+
+# El compilador lee (y mapea en memoria) el archivo directamente
+./bin/Compiler "$@"
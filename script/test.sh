@@ -9,16 +9,33 @@ GREEN='\033[0;32m'
 RED='\033[0;31m'
 OFF='\033[0m'
 
+# An accepted program may also have, in "test/expected/", the exact program it
+# must generate ("<test>.sol") and the code it must remove ("<test>.dead-code",
+# the "deadCode" counters of "--stats").
+OUTPUT="$(mktemp)"
+STATS="$(mktemp)"
+trap 'rm -f "$OUTPUT" "$STATS"' EXIT
+FAILED=0
+
 echo "Compiler should accept..."
 echo ""
 
 for test in $(ls test/accept/); do
-	cat "test/accept/$test" | ./bin/Compiler >/dev/null 2>&1
+	./bin/Compiler -o "$OUTPUT" --stats "$STATS" "test/accept/$test" >/dev/null 2>&1
 	RESULT="$?"
-	if [ "$RESULT" == "0" ]; then
-		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
-	else
+	if [ "$RESULT" != "0" ]; then
 		echo -e "    $test, ${RED}but it rejects${OFF} (status $RESULT)"
+		FAILED=1
+	elif [ -f "test/expected/$test.sol" ] && ! diff -u "test/expected/$test.sol" "$OUTPUT" >/dev/null; then
+		echo -e "    $test, ${RED}but it generates another program${OFF}:"
+		diff -u "test/expected/$test.sol" "$OUTPUT" | sed 's/^/        /'
+		FAILED=1
+	elif [ -f "test/expected/$test.dead-code" ] \
+			&& [ "$(grep -o '"deadCode": {[^}]*}' "$STATS" | head -n 1)" != "$(cat "test/expected/$test.dead-code")" ]; then
+		echo -e "    $test, ${RED}but it removes other code${OFF}: $(grep -o '"deadCode": {[^}]*}' "$STATS" | head -n 1)"
+		FAILED=1
+	else
+		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
 	fi
 done
 echo ""
@@ -27,14 +44,16 @@ echo "Compiler should reject..."
 echo ""
 
 for test in $(ls test/reject/); do
-	cat "test/reject/$test" | ./bin/Compiler >/dev/null 2>&1
+	./bin/Compiler -o "$OUTPUT" "test/reject/$test" >/dev/null 2>&1
 	RESULT="$?"
 	if [ "$RESULT" != "0" ]; then
 		echo -e "    $test, ${GREEN}and it does${OFF} (status $RESULT)"
 	else
 		echo -e "    $test, ${RED}but it accepts${OFF} (status $RESULT)"
+		FAILED=1
 	fi
 done
 echo ""
 
 echo "All done."
+exit $FAILED
@@ -1,593 +1,803 @@
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include "../support/logger.h"
+#include "../domain-specific/builtins.h"
 #include "../support/shared.h"
+#include "../support/thread-pool.h"
+#include "../support/uint256.h"
 #include "generator.h"
 
 /**
  * Implementación de "generator.h".
  */
 
-extern FILE *outputFile;
-extern int indentationSize;
-extern boolean indentUsingSpaces;
-extern boolean indentOutput;
-
-int indentationLevel = 0;
-boolean indentNextOutput = false;
-
-static void includeDependencies(Program *program);
-
-static void generateProgram(Program *program);
-static void generateContractInstructions(ContractInstructions *instructions);
-static void generateContractInstruction(ContractInstruction *instruction);
-static void generateVariableDefinition(Decorators *decorators, VariableDefinition *definition);
-static void generateFunctionCall(FunctionCall *functionCall);
-static void generateFunctionDefinition(FunctionDefinition *definition);
-static void generateFunctionBlock(FunctionBlock *block);
-static void generateFunctionInstructions(FunctionInstructions *instructions);
-static void generateFunctionInstruction(FunctionInstruction *instruction);
-static void generateParameterDefinition(ParameterDefinition *definition, boolean addMemoryLoc);
-static void generateParameters(Parameters *params, boolean addMemoryLoc);
-static void generateDataType(DataType *dataType);
-static void generateExpression(Expression *expression);
-static void generateFactor(Factor *factor);
-static void generateConstant(Constant *constant);
-static void generateAssignable(Assignable *assignable);
-static void generateArguments(Arguments *arguments);
-static void generateConditional(Conditional *conditional);
-static void generateMemberCall(MemberCall *memberCall);
-static void generateLoop(Loop *loop);
-static void generateLoopInitialization(LoopInitialization *loopInit);
-static void generateLoopCondition(LoopCondition *condition);
-static void generateLoopIteration(LoopIteration *loopIteration);
-static void generateAssignment(Assignment *assignment);
-static void generateMathAssignment(MathAssignment *mathAssignment);
-static void generateMathAssignmentOperator(MathAssignmentOperator *operator);
-
-void Generator() {
-	LogInfo("Generating output...");
-	includeDependencies(state.program);
-	generateProgram(state.program);
-}
-
-void applyIndentation(char firstChar, char lastChar) {
-	// Adjust indentation level
-	if (firstChar == '}') --indentationLevel;
-	else if (firstChar == '{') ++indentationLevel;
+// Most operations of a chain walked without allocating memory.
+#define CHAIN_BUFFER_SIZE 32
+
+// Everything a single generation needs, so that several units can be generated at once
+struct GeneratorState {
+	// Compilation whose program is being generated, and its options
+	CompilerState *state;
+	const CompilerOptions *options;
+
+	// Buffer that receives the generated code
+	OutputBuffer *buffer;
+
+	int indentationLevel;
+	boolean indentNextOutput;
+
+	// Indentation characters for the deepest level seen so far (a prefix of it serves any level)
+	char *indentation;
+	size_t indentationCapacity;
+};
+
+static void includeDependencies(GeneratorState *generator, Program *program);
+
+static void generateProgram(GeneratorState *generator, Program *program);
+static void generateContractInstructions(GeneratorState *generator, ContractInstructions *instructions);
+static void generateContractInstruction(GeneratorState *generator, ContractInstruction *instruction);
+static void generateVariableDefinition(GeneratorState *generator, Decorators *decorators, VariableDefinition *definition);
+static void generateFunctionCall(GeneratorState *generator, FunctionCall *functionCall);
+static void generateFunctionDefinition(GeneratorState *generator, FunctionDefinition *definition);
+static void generateFunctionBlock(GeneratorState *generator, FunctionBlock *block);
+static void generateFunctionInstructions(GeneratorState *generator, FunctionInstructions *instructions);
+static void generateFunctionInstruction(GeneratorState *generator, FunctionInstruction *instruction);
+static void generateParameterDefinition(GeneratorState *generator, ParameterDefinition *definition, boolean addMemoryLoc);
+static void generateParameters(GeneratorState *generator, Parameters *params, boolean addMemoryLoc);
+static void generateDataType(GeneratorState *generator, DataType *dataType);
+static void generateElementaryType(GeneratorState *generator, DataTypeType type);
+static void generateExpression(GeneratorState *generator, Expression *expression);
+static void generateOperator(GeneratorState *generator, ExpressionType type);
+static void generateFactor(GeneratorState *generator, Factor *factor);
+static void generateConstant(GeneratorState *generator, Constant *constant);
+static void generateNumber(GeneratorState *generator, Number *number, boolean scientific);
+static void generateAssignable(GeneratorState *generator, Assignable *assignable);
+static void generateArguments(GeneratorState *generator, Arguments *arguments);
+static void generateConditional(GeneratorState *generator, Conditional *conditional);
+static void generateMemberCall(GeneratorState *generator, MemberCall *memberCall);
+static void generateCachedVariables(GeneratorState *generator, CachedVariables *cached);
+static void generateLoop(GeneratorState *generator, Loop *loop);
+static void generateLoopInitialization(GeneratorState *generator, LoopInitialization *loopInit);
+static void generateLoopCondition(GeneratorState *generator, LoopCondition *condition);
+static void generateLoopIteration(GeneratorState *generator, LoopIteration *loopIteration);
+static void generateAssignment(GeneratorState *generator, Assignment *assignment);
+static void generateMathAssignment(GeneratorState *generator, MathAssignment *mathAssignment);
+static void generateMathAssignmentOperator(GeneratorState *generator, MathAssignmentOperator *operator);
+
+void Generator(CompilerState *state, FILE *outputFile) {
+	OutputBuffer program;
+	initOutputBuffer(&program);
+
+	GenerateToBuffer(state, &program);
+
+	// Single write for the whole program
+	fwrite(program.data, sizeof(char), program.length, outputFile);
+	freeOutputBuffer(&program);
+}
 
-	// Add indentation
-	if (indentNextOutput) {
-		for (int i = 0; i < indentationLevel; ++i) {
-			for (int j = 0; j < indentationSize; ++j) {
-				fprintf(outputFile, "%s", indentUsingSpaces ? " " : "\t");
-			}
+void GenerateToBuffer(CompilerState *state, OutputBuffer *target) {
+	GeneratorState generator = {
+		.state = state,
+		.options = state->options,
+		.buffer = target,
+		.indentationLevel = 0,
+		.indentNextOutput = false,
+		.indentation = NULL,
+		.indentationCapacity = 0
+	};
+
+	includeDependencies(&generator, state->program);
+	generateProgram(&generator, state->program);
+
+	free(generator.indentation);
+}
+
+static void appendIndentation(GeneratorState *generator, int level) {
+	if (level <= 0) return;
+	size_t length = (size_t) level * generator->options->indentationSize;
+
+	if (length > generator->indentationCapacity) {
+		size_t capacity = generator->indentationCapacity == 0 ? 16 * generator->options->indentationSize : generator->indentationCapacity;
+		while (capacity < length) capacity *= 2;
+		char *indentation = realloc(generator->indentation, capacity);
+		if (indentation == NULL) {
+			perror("Error growing indentation");
+			exit(EXIT_FAILURE);
 		}
+		generator->indentation = indentation;
+		memset(generator->indentation, generator->options->indentUsingSpaces ? ' ' : '\t', capacity);
+		generator->indentationCapacity = capacity;
 	}
 
+	appendToBuffer(generator->buffer, generator->indentation, length);
+}
+
+static void applyIndentation(GeneratorState *generator, char firstChar, char lastChar) {
+	// Adjust indentation level (a block that opens a line is indented as the line before it)
+	if (firstChar == '}') --generator->indentationLevel;
+
+	// Add indentation
+	if (generator->indentNextOutput) appendIndentation(generator, generator->indentationLevel);
+	if (firstChar == '{') ++generator->indentationLevel;
+
 	// Indent next line
-	if (lastChar == '\n') indentNextOutput = true;
-	else indentNextOutput = false;
+	if (lastChar == '\n') generator->indentNextOutput = true;
+	else generator->indentNextOutput = false;
+}
+
+static void outputFormat(GeneratorState *generator, const char *format, va_list args) {
+	// Single pass over the format: find its length and whether it has directives
+	size_t length = 0;
+	boolean isLiteral = true;
+	for (; format[length] != '\0'; ++length) {
+		if (format[length] == '%') isLiteral = false;
+	}
+
+	if (generator->options->indentOutput) applyIndentation(generator, format[0], format[length - 1]);
+
+	if (isLiteral) appendToBuffer(generator->buffer, format, length);
+	else appendFormatToBuffer(generator->buffer, format, args);
 }
 
-static void output(const char *format, ...) {
+static void output(GeneratorState *generator, const char *format, ...) {
 	va_list args;
 	va_start(args, format);
+	outputFormat(generator, format, args);
+	va_end(args);
+}
 
-	if (indentOutput) applyIndentation(format[0], format[strlen(format) - 1]);
+void GenerateOutput(GeneratorState *generator, const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	outputFormat(generator, format, args);
+	va_end(args);
+}
 
-	vfprintf(outputFile, format, args);
+void GenerateArguments(GeneratorState *generator, Arguments *arguments) {
+	generateArguments(generator, arguments);
+}
 
-	va_end(args);
+void GenerateExpression(GeneratorState *generator, Expression *expression) {
+	generateExpression(generator, expression);
 }
 
-static void includeDependencies(Program *program) {
+static void includeDependencies(GeneratorState *generator, Program *program) {
 	// License and pragma
-	output("// SPDX-License-Identifier: MIT\n");
-	output("pragma solidity ^0.8.0;\n\n");
+	output(generator, "// SPDX-License-Identifier: MIT\n");
+	output(generator, "pragma solidity ^0.8.0;\n\n");
 
 	// Add imports
-	output("import \"@openzeppelin/contracts/utils/ReentrancyGuard.sol\";\n"); // public functions are nonReentrant
-	if (state.libraries[LIBRARY_ERC20]) output("import \"@openzeppelin/contracts/token/ERC20/IERC20.sol\";\n");
-	if (state.libraries[LIBRARY_ERC721]) output("import \"@openzeppelin/contracts/token/ERC721/IERC721.sol\";\n");
-	if (state.libraries[LIBRARY_CLONES]) output("import \"@openzeppelin/contracts/proxy/Clones.sol\";\n");
-	if (state.libraries[LIBRARY_CONSOLE]) output("import \"forge-std/console.sol\";\n");
+	output(generator, "import \"@openzeppelin/contracts/utils/ReentrancyGuard.sol\";\n"); // public functions are nonReentrant
+	if (generator->state->libraries[LIBRARY_ERC20]) output(generator, "import \"@openzeppelin/contracts/token/ERC20/IERC20.sol\";\n");
+	if (generator->state->libraries[LIBRARY_ERC721]) output(generator, "import \"@openzeppelin/contracts/token/ERC721/IERC721.sol\";\n");
+	if (generator->state->libraries[LIBRARY_CLONES]) output(generator, "import \"@openzeppelin/contracts/proxy/Clones.sol\";\n");
+	if (generator->state->libraries[LIBRARY_CONSOLE]) output(generator, "import \"forge-std/console.sol\";\n");
+
+	output(generator, "\n");
+}
 
-	output("\n");
+static void generateProgram(GeneratorState *generator, Program *program) {
+	output(generator, "contract %s is ReentrancyGuard ", program->contract->identifier);
+	output(generator, "{");
+	generateContractInstructions(generator, program->contract->block->instructions);
+	output(generator, "}\n");
+}
+
+static void generateContractInstructionRange(GeneratorState *generator, ContractInstructions *instructions, int start, int end) {
+	for (int i = start; i < end; ++i) {
+		output(generator, "\n");
+		generateContractInstruction(generator, instructions->instructions[i]);
+	}
 }
 
-static void generateProgram(Program *program) {
-	output("contract %s is ReentrancyGuard ", program->contract->identifier);
-	output("{");
-	generateContractInstructions(program->contract->block->instructions);
-	output("}\n");
+/**
+ * The functions of the contract can be generated on their own, so a pool of
+ * threads generates contiguous ranges of contract instructions, each one into
+ * its own buffer. The buffers are then appended in the order of the program,
+ * so the output is the same as when generated in a single thread.
+ */
+
+// Code of a range of contract instructions, and the indentation it leaves behind.
+typedef struct {
+	OutputBuffer buffer;
+	int end;
+	int indentationLevel;
+	boolean indentNextOutput;
+} RangeOutput;
+
+typedef struct {
+	GeneratorState *generator;
+	ContractInstructions *instructions;
+	RangeOutput *ranges; // indexed by the first instruction of each range
+} ParallelGeneration;
+
+static void generateRangeOutput(void *context, int start, int end, int worker) {
+	(void) worker; // each range has its own generator, so the worker needs no state of its own
+	ParallelGeneration *generation = context;
+	GeneratorState *parent = generation->generator;
+	RangeOutput *range = &generation->ranges[start];
+	initOutputBuffer(&range->buffer);
+
+	// Every contract instruction ends its line, so the ones after the first
+	// instruction start like it, but with the next output indented
+	GeneratorState generator = {
+		.state = parent->state,
+		.options = parent->options,
+		.buffer = &range->buffer,
+		.indentationLevel = parent->indentationLevel,
+		.indentNextOutput = start == 0 ? parent->indentNextOutput : parent->options->indentOutput,
+		.indentation = NULL,
+		.indentationCapacity = 0
+	};
+
+	generateContractInstructionRange(&generator, generation->instructions, start, end);
+	range->end = end;
+	range->indentationLevel = generator.indentationLevel;
+	range->indentNextOutput = generator.indentNextOutput;
+	free(generator.indentation);
 }
 
-static void generateContractInstructions(ContractInstructions *instructions) {
-	if (instructions->type == CONTRACT_INSTRUCTIONS_MULTIPLE) {
-		generateContractInstructions(instructions->instructions);
-		output("\n");
-		generateContractInstruction(instructions->instruction);
+static void generateContractInstructions(GeneratorState *generator, ContractInstructions *instructions) {
+	int functions = 0;
+	for (int i = 0; i < instructions->count; ++i)
+		if (instructions->instructions[i]->type == FUNCTION_DECLARATION) ++functions;
+
+	const int jobs = generator->options->jobs < functions ? generator->options->jobs : functions;
+	if (jobs <= 1) {
+		generateContractInstructionRange(generator, instructions, 0, instructions->count);
+		return;
+	}
+
+	ParallelGeneration generation = { generator, instructions, calloc(instructions->count, sizeof(RangeOutput)) };
+	if (generation.ranges == NULL) {
+		perror("Error allocating the parallel generation");
+		exit(EXIT_FAILURE);
+	}
+	parallelFor(instructions->count, jobs, generateRangeOutput, &generation);
+
+	for (int i = 0; i < instructions->count; i = generation.ranges[i].end) {
+		RangeOutput *range = &generation.ranges[i];
+		appendToBuffer(generator->buffer, range->buffer.data, range->buffer.length);
+		generator->indentationLevel = range->indentationLevel;
+		generator->indentNextOutput = range->indentNextOutput;
+		freeOutputBuffer(&range->buffer);
 	}
-	// else: CONTRACT_INSTRUCTIONS_EMPTY, do nothing
+	free(generation.ranges);
 }
 
-static void generateContractInstruction(ContractInstruction *instruction) {
+static void generateContractInstruction(GeneratorState *generator, ContractInstruction *instruction) {
 	switch (instruction->type) {
 		case STATE_VARIABLE_DECLARATION:
-			generateVariableDefinition(instruction->variableDecorators, instruction->variableDefinition);
-			output(";\n");
+			generateVariableDefinition(generator, instruction->variableDecorators, instruction->variableDefinition);
+			output(generator, ";\n");
 			break;
 		case FUNCTION_DECLARATION:
-			generateFunctionDefinition(instruction->functionDefinition);
+			generateFunctionDefinition(generator, instruction->functionDefinition);
 			break;
 		case EVENT_DECLARATION:
-			output("event %s", instruction->eventIdentifier);
-			generateParameterDefinition(instruction->eventParams, false);
-			output(";\n");
+			output(generator, "event %s", instruction->eventIdentifier);
+			generateParameterDefinition(generator, instruction->eventParams, false);
+			output(generator, ";\n");
 			break;
 	}
 }
 
-static void generateVariableDefinition(Decorators *decorators, VariableDefinition *definition) {
-	generateDataType(definition->dataType);
+static void generateVariableDefinition(GeneratorState *generator, Decorators *decorators, VariableDefinition *definition) {
+	generateDataType(generator, definition->dataType);
 
 	if (decorators == NULL) {
 		switch (definition->dataType->type) {
 			case DATA_TYPE_BYTES:
 			case DATA_TYPE_STRING:
 			case DATA_TYPE_ARRAY:
-				output(" memory");
+				output(generator, " memory");
 				break;
 		}
 	}
 
 	// State variables will be internal by default, if not specified otherwise with a decorator
 	while (decorators != NULL && decorators->decorator != NULL) {
-		output(" %s", decorators->decorator);
+		output(generator, " %s", decorators->decorator);
 		decorators = decorators->decorators;
 	}
 
-	output(" %s", definition->identifier);
+	output(generator, " %s", definition->identifier);
 
 	if (definition->dataType->type == DATA_TYPE_ARRAY) {
-		output(" = new ");
-		generateDataType(definition->dataType);
-		output("(");
-		generateExpression(definition->dataType->expression); // array size
-		output(")");
+		output(generator, " = new ");
+		generateDataType(generator, definition->dataType);
+		output(generator, "(");
+		generateExpression(generator, definition->dataType->expression); // array size
+		output(generator, ")");
 	}
 
 	if (definition->type != VARIABLE_DEFINITION_DECLARATION) {
-		output(" = ");
-		if (definition->dataType->type == DATA_TYPE_ERC20) output("IERC20(");
-		if (definition->dataType->type == DATA_TYPE_ERC721) output("IERC721(");
+		output(generator, " = ");
+		if (definition->dataType->type == DATA_TYPE_ERC20) output(generator, "IERC20(");
+		if (definition->dataType->type == DATA_TYPE_ERC721) output(generator, "IERC721(");
 	}
 	
 	switch(definition->type) {
 		case VARIABLE_DEFINITION_INIT_EXPRESSION:
-			generateExpression(definition->expression);
+			generateExpression(generator, definition->expression);
 			break;
 		case VARIABLE_DEFINITION_INIT_FUNCTION_CALL:
-			generateFunctionCall(definition->functionCall);
+			generateFunctionCall(generator, definition->functionCall);
 			break;
 	}
 
 	if (definition->type != VARIABLE_DEFINITION_DECLARATION) {
-		if (definition->dataType->type == DATA_TYPE_ERC20) output(")");
-		if (definition->dataType->type == DATA_TYPE_ERC721) output(")");
+		if (definition->dataType->type == DATA_TYPE_ERC20) output(generator, ")");
+		if (definition->dataType->type == DATA_TYPE_ERC721) output(generator, ")");
 	}
 }
 
-static void generateFunctionCall(FunctionCall *functionCall) {
+static void generateFunctionCall(GeneratorState *generator, FunctionCall *functionCall) {
+	if (functionCall->builtIn != NULL && functionCall->builtIn->generate != NULL) {
+		functionCall->builtIn->generate(generator, functionCall);
+		return;
+	}
+
 	switch (functionCall->type)	{
 		case FUNCTION_CALL_NO_ARGS:
-			output("%s()", functionCall->identifier);
+			output(generator, "%s()", functionCall->identifier);
 			break;
 		case FUNCTION_CALL_WITH_ARGS:
-			output("%s(", functionCall->identifier);
-			generateArguments(functionCall->arguments);
-			output(")");
-			break;
-		case BUILT_IN_TRANSFER_ETH: {
-			Arguments *amountArg = functionCall->arguments;
-			Arguments *addressArg = amountArg->arguments;
-
-			char *address;
-
-			if (addressArg->expression->factor->constant->type == CONSTANT_ADDRESS)
-				address = addressArg->expression->factor->constant->string;
-			else
-				address = addressArg->expression->factor->constant->variable->identifier;
-
-			output("(bool s, ) = ");
-
-			if (amountArg->expression->factor->constant->type == CONSTANT_INTEGER) {
-				int amount = amountArg->expression->factor->constant->value;
-				output("address(%s).call{value: %d}(\"\");\n", address, amount);
-			}
-			else if (amountArg->expression->factor->constant->type == CONSTANT_SCIENTIFIC_NOTATION) {
-				char *amount = amountArg->expression->factor->constant->string;
-				output("address(%s).call{value: %s}(\"\");\n", address, amount);
-			}
-
-			output("require(s, \"ETH transfer failed\")");
-			break;
-		}
-		case BUILT_IN_BALANCE:
-			output("address(");
-			generateArguments(functionCall->arguments);
-			output(").balance");
-			break;
-		case BUILT_IN_LOG:
-			output("console.log(");
-			generateArguments(functionCall->arguments);
-			output(")");
-			break;
-		case BUILT_IN_CREATE_PROXY_TO:
-			output("Clones.clone(address(");
-			generateArguments(functionCall->arguments);
-			output("))");
+			output(generator, "%s(", functionCall->identifier);
+			generateArguments(generator, functionCall->arguments);
+			output(generator, ")");
 			break;
 	}
 }
 
-static void generateArguments(Arguments *arguments) {
-	switch (arguments->type) {
-		case ARGUMENTS_MULTIPLE:
-			generateArguments(arguments->arguments);
-			output(", ");
-			generateExpression(arguments->expression);
-			break;
-		case ARGUMENTS_SINGLE:
-			generateExpression(arguments->expression);
-			break;
-		case ARGUMENTS_EMPTY:
-			break;
+static void generateArguments(GeneratorState *generator, Arguments *arguments) {
+	for (int i = 0; i < arguments->count; ++i) {
+		if (i > 0) output(generator, ", ");
+		generateExpression(generator, arguments->expressions[i]);
 	}
 }
 
-static void generateFunctionDefinition(FunctionDefinition *function) {
-	output("function %s", function->identifier);
-	generateParameterDefinition(function->parameterDefinition, true);
+static void generateFunctionDefinition(GeneratorState *generator, FunctionDefinition *function) {
+	output(generator, "function %s", function->identifier);
+	generateParameterDefinition(generator, function->parameterDefinition, true);
 
 	boolean isPublic = false;
 
 	Decorators *decorators = function->decorators;
 	if (decorators->decorator == NULL) {
 		// If no decorator is specified, the function will be internal by default
-		output(" internal");
+		output(generator, " internal");
 	}
 	while (decorators->decorator != NULL) {
 		if (strcmp(decorators->decorator, "public") == 0) isPublic = true;
-		output(" %s", decorators->decorator);
+		output(generator, " %s", decorators->decorator);
 		decorators = decorators->decorators;
 	}
 
-	if (isPublic) output(" nonReentrant");
+	if (isPublic) output(generator, " nonReentrant");
 
-	output(" ");
-	generateFunctionBlock(function->functionBlock);
+	output(generator, " ");
+	output(generator, "{\n");
+	generateCachedVariables(generator, function->cachedVariables);
+	generateFunctionInstructions(generator, function->functionBlock->instructions);
+	output(generator, "}\n");
 }
 
-static void generateParameterDefinition(ParameterDefinition *definition, boolean addMemoryLoc) {
-	output("(");
+static void generateParameterDefinition(GeneratorState *generator, ParameterDefinition *definition, boolean addMemoryLoc) {
+	output(generator, "(");
 
 	if (definition->type == PARAMETERS_DEFINITION_WITH_PARAMS)
-		generateParameters(definition->parameters, addMemoryLoc);
+		generateParameters(generator, definition->parameters, addMemoryLoc);
 
-	output(")");
+	output(generator, ")");
 }
 
-static void generateFunctionBlock(FunctionBlock *block) {
-	output("{\n");
-	generateFunctionInstructions(block->instructions);
-	output("}\n");
+static void generateFunctionBlock(GeneratorState *generator, FunctionBlock *block) {
+	output(generator, "{\n");
+	generateFunctionInstructions(generator, block->instructions);
+	output(generator, "}\n");
 }
 
-static void generateFunctionInstructions(FunctionInstructions *instructions) {
-	if (instructions->type == FUNCTION_INSTRUCTIONS_MULTIPLE) {
-		generateFunctionInstructions(instructions->instructions);
-		generateFunctionInstruction(instructions->instruction);
+static void generateFunctionInstructions(GeneratorState *generator, FunctionInstructions *instructions) {
+	for (int i = 0; i < instructions->count; ++i) {
+		generateFunctionInstruction(generator, instructions->instructions[i]);
 	}
-	// else: FUNCTION_INSTRUCTIONS_EMPTY, do nothing
 }
 
-static void generateFunctionInstruction(FunctionInstruction *instruction) {
+static void generateFunctionInstruction(GeneratorState *generator, FunctionInstruction *instruction) {
 	switch (instruction->type) {
 		case FUNCTION_INSTRUCTION_VARIABLE_DEFINITION:
-			generateVariableDefinition(NULL, instruction->variableDefinition);
-			output(";\n");
+			generateVariableDefinition(generator, NULL, instruction->variableDefinition);
+			output(generator, ";\n");
 			break;
 		case FUNCTION_INSTRUCTION_CONDITIONAL:
-			generateConditional(instruction->conditional);
+			generateConditional(generator, instruction->conditional);
 			break;
 		case FUNCTION_INSTRUCTION_FUNCTION_CALL:
-			generateFunctionCall(instruction->functionCall);
-			output(";\n");
+			generateFunctionCall(generator, instruction->functionCall);
+			output(generator, ";\n");
 			break;
 		case FUNCTION_INSTRUCTION_MEMBER_CALL:
-			generateMemberCall(instruction->memberCall);
-			output(";\n");
+			generateMemberCall(generator, instruction->memberCall);
+			output(generator, ";\n");
 			break;
 		case FUNCTION_INSTRUCTION_EMIT_EVENT:
-			output("emit %s(", instruction->eventIdentifier);
-			generateArguments(instruction->eventArgs);
-			output(");\n");
+			output(generator, "emit %s(", instruction->eventIdentifier);
+			generateArguments(generator, instruction->eventArgs);
+			output(generator, ");\n");
 			break;
 		case FUNCTION_INSTRUCTION_ASSIGNMENT:
-			generateAssignment(instruction->assignment);
-			output(";\n");
+			generateAssignment(generator, instruction->assignment);
+			output(generator, ";\n");
 			break;
 		case FUNCTION_INSTRUCTION_MATH_ASSIGNMENT:
-			generateMathAssignment(instruction->mathAssignment);
-			output(";\n");
+			generateMathAssignment(generator, instruction->mathAssignment);
+			output(generator, ";\n");
 			break;
 		case FUNCTION_INSTRUCTION_LOOP:
-			generateLoop(instruction->loop);
+			generateLoop(generator, instruction->loop);
 			break;
 	}
 }
 
-static void generateConditional(Conditional *conditional) {
-	output("if (");
-	generateExpression(conditional->condition);
-	output(") ");
-	generateFunctionBlock(conditional->ifBlock);
+static void generateConditional(GeneratorState *generator, Conditional *conditional) {
+	output(generator, "if (");
+	generateExpression(generator, conditional->condition);
+	output(generator, ") ");
+	generateFunctionBlock(generator, conditional->ifBlock);
 	if (conditional->type == CONDITIONAL_WITH_ELSE) {
-		output("else ");
-		generateFunctionBlock(conditional->elseBlock);
+		output(generator, "else ");
+		generateFunctionBlock(generator, conditional->elseBlock);
 	}
 }
 
-static void generateMemberCall(MemberCall *memberCall) {
-	generateAssignable(memberCall->instance);
-	output(".");
-	generateFunctionCall(memberCall->method);
+static void generateMemberCall(GeneratorState *generator, MemberCall *memberCall) {
+	generateAssignable(generator, memberCall->instance);
+	output(generator, ".");
+	generateFunctionCall(generator, memberCall->method);
 }
 
-static void generateLoop(Loop *loop) {
-	output("for (");
-	generateLoopInitialization(loop->loopInitialization);
-	output("; ");
-	generateLoopCondition(loop->loopCondition);
-	output("; ");
-	generateLoopIteration(loop->loopIteration);
-	output(") ");
-	generateFunctionBlock(loop->functionBlock);
+// The name of the local that holds the cached bound of a loop ("$" never appears in an identifier of the program).
+static void generateLoopBound(GeneratorState *generator, Loop *loop) {
+	output(generator, "%s$bound", loop->loopIteration->mathAssignment->variable->identifier);
 }
 
-static void generateLoopInitialization(LoopInitialization *loopInit) {
+// The local copies of the state variables that are not read from storage (see "storage-caching.h").
+static void generateCachedVariables(GeneratorState *generator, CachedVariables *cached) {
+	if (cached == NULL) return;
+	for (int i = 0; i < cached->count; ++i) {
+		generateElementaryType(generator, cached->symbols[i]->type);
+		output(generator, " %s$cached = %s;\n", cached->symbols[i]->identifier, cached->symbols[i]->identifier);
+	}
+}
+
+static void generateLoop(GeneratorState *generator, Loop *loop) {
+	// The copies made before the loop (see "storage-caching.h" and "loop-optimization.h") only live as long as it
+	Expression *condition = loop->loopCondition->condition;
+	const boolean scoped = loop->cachedBound || loop->cachedVariables != NULL;
+	if (scoped) output(generator, "{\n");
+	generateCachedVariables(generator, loop->cachedVariables);
+	if (loop->cachedBound) {
+		output(generator, condition->right->inferredType == DATA_TYPE_UINT ? "uint " : "int ");
+		generateLoopBound(generator, loop);
+		output(generator, " = ");
+		generateExpression(generator, condition->right);
+		output(generator, ";\n");
+	}
+
+	output(generator, "for (");
+	generateLoopInitialization(generator, loop->loopInitialization);
+	output(generator, "; ");
+	if (loop->cachedBound) {
+		generateExpression(generator, condition->left);
+		output(generator, condition->type == EXPRESSION_LESS_THAN ? " < " : " > ");
+		generateLoopBound(generator, loop);
+	}
+	else generateLoopCondition(generator, loop->loopCondition);
+	output(generator, "; ");
+
+	if (loop->uncheckedIteration) {
+		MathAssignment *step = loop->loopIteration->mathAssignment;
+		const boolean increment = step->type == MATH_ASSIGNMENT_INCREMENT
+			|| (step->type == MATH_ASSIGNMENT_OPERATOR && step->operator->type == MATH_ASSIGNMENT_OP_ADD_EQUAL);
+		output(generator, ") ");
+		output(generator, "{\n");
+		generateFunctionInstructions(generator, loop->functionBlock->instructions);
+		output(generator, "unchecked { %s%s; }\n", increment ? "++" : "--", step->variable->identifier);
+		output(generator, "}\n");
+	}
+	else {
+		generateLoopIteration(generator, loop->loopIteration);
+		output(generator, ") ");
+		generateFunctionBlock(generator, loop->functionBlock);
+	}
+
+	if (scoped) output(generator, "}\n");
+}
+
+static void generateLoopInitialization(GeneratorState *generator, LoopInitialization *loopInit) {
 	switch (loopInit->type) {
 		case LOOP_INITIALIZATION_VARIABLE_DEFINITION:
-			generateVariableDefinition(NULL, loopInit->variable);
+			generateVariableDefinition(generator, NULL, loopInit->variable);
 			break;
 		case LOOP_INITIALIZATION_ASSIGNMENT:
-			generateAssignment(loopInit->assignment);
+			generateAssignment(generator, loopInit->assignment);
 			break;
 		case LOOP_INITIALIZATION_MATH_ASSIGNMENT:
-			generateMathAssignment(loopInit->mathAssignment);
+			generateMathAssignment(generator, loopInit->mathAssignment);
 			break;
 		case LOOP_INITIALIZATION_EMPTY:
 			break;
 	}
 }
 
-static void generateLoopCondition(LoopCondition *condition) {
+static void generateLoopCondition(GeneratorState *generator, LoopCondition *condition) {
 	if (condition->type == LOOP_CONDITION_CONDITIONAL)
-		generateExpression(condition->condition);
+		generateExpression(generator, condition->condition);
 }
 
-static void generateLoopIteration(LoopIteration *loopIteration) {
+static void generateLoopIteration(GeneratorState *generator, LoopIteration *loopIteration) {
 	switch (loopIteration->type) {
 		case LOOP_ITERATION_ASSIGNMENT:
-			generateAssignment(loopIteration->assignment);
+			generateAssignment(generator, loopIteration->assignment);
 			break;
 		case LOOP_ITERATION_MATH_ASSIGNMENT:
-			generateMathAssignment(loopIteration->mathAssignment);
+			generateMathAssignment(generator, loopIteration->mathAssignment);
 			break;
 		case LOOP_ITERATION_EMPTY:
 			break;
 	}
 }
 
-static void generateAssignment(Assignment *assignment) {
-	generateAssignable(assignment->assignable);
-	output(" = ");
+static void generateAssignment(GeneratorState *generator, Assignment *assignment) {
+	generateAssignable(generator, assignment->assignable);
+	output(generator, " = ");
 	switch (assignment->type) {
 		case ASSIGNMENT_EXPRESSION:
-			generateExpression(assignment->expression);
+			generateExpression(generator, assignment->expression);
 			break;
 		case ASSIGNMENT_FUNCTION_CALL:
-			generateFunctionCall(assignment->functionCall);
+			generateFunctionCall(generator, assignment->functionCall);
 			break;
 	}
 }
 
-static void generateMathAssignment(MathAssignment *mathAssignment) {
-	generateAssignable(mathAssignment->variable);
+static void generateMathAssignment(GeneratorState *generator, MathAssignment *mathAssignment) {
+	generateAssignable(generator, mathAssignment->variable);
 	switch (mathAssignment->type) {
 		case MATH_ASSIGNMENT_OPERATOR:
-			generateMathAssignmentOperator(mathAssignment->operator);
-			generateExpression(mathAssignment->expression);
+			generateMathAssignmentOperator(generator, mathAssignment->operator);
+			generateExpression(generator, mathAssignment->expression);
 			break;
 		case MATH_ASSIGNMENT_INCREMENT:
-			output("++");
+			output(generator, "++");
 			break;
 		case MATH_ASSIGNMENT_DECREMENT:
-			output("--");
+			output(generator, "--");
 			break;
 	}
 }
 
-static void generateMathAssignmentOperator(MathAssignmentOperator *operator) {
+static void generateMathAssignmentOperator(GeneratorState *generator, MathAssignmentOperator *operator) {
 	switch (operator->type) {
 		case MATH_ASSIGNMENT_OP_ADD_EQUAL:
-			output(" += ");
+			output(generator, " += ");
 			break;
 		case MATH_ASSIGNMENT_OP_SUBTRACT_EQUAL:
-			output(" -= ");
+			output(generator, " -= ");
 			break;
 		case MATH_ASSIGNMENT_OP_MULTIPLY_EQUAL:
-			output(" *= ");
+			output(generator, " *= ");
 			break;
 		case MATH_ASSIGNMENT_OP_DIVIDE_EQUAL:
-			output(" /= ");
+			output(generator, " /= ");
 			break;
 		case MATH_ASSIGNMENT_OP_MODULO_EQUAL:
-			output(" %%= ");
+			output(generator, " %%= ");
 			break;
 	}
 }
 
-static void generateParameters(Parameters *params, boolean addMemoryLoc) {
-	if (params->type == PARAMETERS_MULTIPLE) {
-		generateParameters(params->parameters, addMemoryLoc);
-		output(", ");
-	}
-	generateDataType(params->dataType);
-
-	if (addMemoryLoc) {
-		switch (params->dataType->type) {
-			case DATA_TYPE_BYTES:
-			case DATA_TYPE_STRING:
-			case DATA_TYPE_ARRAY:
-				output(" memory");
-				break;
+static void generateParameters(GeneratorState *generator, Parameters *params, boolean addMemoryLoc) {
+	for (int i = 0; i < params->count; ++i) {
+		Parameter *param = &params->parameters[i];
+		if (i > 0) output(generator, ", ");
+		generateDataType(generator, param->dataType);
+
+		if (addMemoryLoc) {
+			switch (param->dataType->type) {
+				case DATA_TYPE_BYTES:
+				case DATA_TYPE_STRING:
+				case DATA_TYPE_ARRAY:
+					output(generator, " memory");
+					break;
+			}
 		}
-	}
 
-	output(" %s", params->identifier);
+		output(generator, " %s", param->identifier);
+	}
 }
 
-static void generateDataType(DataType *dataType) {
+static void generateDataType(GeneratorState *generator, DataType *dataType) {
 	if (dataType->type == DATA_TYPE_ARRAY) {
-		generateDataType(dataType->dataType);
-		output("[]");
-	} else {
-		switch (dataType->type) {
-			case DATA_TYPE_ERC20:
-				output("IERC20");
-				break;
-			case DATA_TYPE_ERC721:
-				output("IERC721");
-				break;
-			case DATA_TYPE_BYTES:
-				output("bytes");
-				break;
-			case DATA_TYPE_STRING:
-				output("string");
-				break;
-			case DATA_TYPE_BOOLEAN:
-				output("bool");
-				break;
-			case DATA_TYPE_ADDRESS:
-				output("address");
-				break;
-			case DATA_TYPE_UINT:
-				output("uint");
-				break;
-			case DATA_TYPE_INT:
-				output("int");
-				break;
+		generateDataType(generator, dataType->dataType);
+		output(generator, "[]");
+	} else generateElementaryType(generator, dataType->type);
+}
+
+static void generateElementaryType(GeneratorState *generator, DataTypeType type) {
+	switch (type) {
+		case DATA_TYPE_ERC20:
+			output(generator, "IERC20");
+			break;
+		case DATA_TYPE_ERC721:
+			output(generator, "IERC721");
+			break;
+		case DATA_TYPE_BYTES:
+			output(generator, "bytes");
+			break;
+		case DATA_TYPE_STRING:
+			output(generator, "string");
+			break;
+		case DATA_TYPE_BOOLEAN:
+			output(generator, "bool");
+			break;
+		case DATA_TYPE_ADDRESS:
+			output(generator, "address");
+			break;
+		case DATA_TYPE_UINT:
+			output(generator, "uint");
+			break;
+		case DATA_TYPE_INT:
+			output(generator, "int");
+			break;
+		default:
+			break;
+	}
+}
+
+/**
+ * A chain of operations such as `x + x + ... + x` nests to the left, as deep
+ * as its number of terms, so its left operands are followed in a loop: the
+ * innermost operand is generated first, and then each operator along with its
+ * right operand, back up to "expression".
+ */
+static void generateExpression(GeneratorState *generator, Expression *expression) {
+	Expression *buffer[CHAIN_BUFFER_SIZE];
+	Expression **chain = buffer;
+	int count = 0, capacity = CHAIN_BUFFER_SIZE;
+	for (; expression->type != EXPRESSION_NOT && expression->type != EXPRESSION_FACTOR; expression = expression->left) {
+		if (count == capacity) {
+			capacity *= 2;
+			Expression **grown = chain == buffer ? malloc(capacity * sizeof(Expression *)) : realloc(chain, capacity * sizeof(Expression *));
+			if (grown == NULL) {
+				perror("Error growing an operation chain");
+				exit(EXIT_FAILURE);
+			}
+			if (chain == buffer) memcpy(grown, buffer, sizeof(buffer));
+			chain = grown;
 		}
+		chain[count++] = expression;
+	}
+
+	if (expression->type == EXPRESSION_FACTOR) generateFactor(generator, expression->factor);
+	else {
+		output(generator, "!");
+		generateExpression(generator, expression->right);
+	}
+	while (count > 0) {
+		Expression *operation = chain[--count];
+		generateOperator(generator, operation->type);
+		generateExpression(generator, operation->right);
 	}
+
+	if (chain != buffer) free(chain);
 }
 
-static void generateExpression(Expression *expression) {
-	if (expression->type != EXPRESSION_NOT && expression->type != EXPRESSION_FACTOR)
-		generateExpression(expression->left);
-	
-	switch (expression->type) {
+static void generateOperator(GeneratorState *generator, ExpressionType type) {
+	switch (type) {
 		case EXPRESSION_ADDITION:
-			output(" + ");
+			output(generator, " + ");
 			break;
 		case EXPRESSION_SUBTRACTION:
-			output(" - ");
+			output(generator, " - ");
 			break;
 		case EXPRESSION_MULTIPLICATION:
-			output(" * ");
+			output(generator, " * ");
 			break;
 		case EXPRESSION_DIVISION:
-			output(" / ");
+			output(generator, " / ");
 			break;
 		case EXPRESSION_MODULO:
-			output(" %% ");
+			output(generator, " %% ");
+			break;
+		case EXPRESSION_EXPONENTIATION:
+			output(generator, " ** ");
 			break;
 		case EXPRESSION_EQUALITY:
-			output(" == ");
+			output(generator, " == ");
 			break;
 		case EXPRESSION_INEQUALITY:
-			output(" != ");
+			output(generator, " != ");
 			break;
 		case EXPRESSION_LESS_THAN:
-			output(" < ");
+			output(generator, " < ");
 			break;
 		case EXPRESSION_LESS_THAN_OR_EQUAL:
-			output(" <= ");
+			output(generator, " <= ");
 			break;
 		case EXPRESSION_GREATER_THAN:
-			output(" > ");
+			output(generator, " > ");
 			break;
 		case EXPRESSION_GREATER_THAN_OR_EQUAL:
-			output(" >= ");
+			output(generator, " >= ");
 			break;
 		case EXPRESSION_AND:
-			output(" && ");
+			output(generator, " && ");
 			break;
 		case EXPRESSION_OR:
-			output(" || ");
+			output(generator, " || ");
 			break;
-		case EXPRESSION_NOT:
-			output("!");
-			break;
-		case EXPRESSION_FACTOR:
-			generateFactor(expression->factor);
+		default:
 			break;
 	}
-
-	if (expression->type != EXPRESSION_FACTOR)
-		generateExpression(expression->right);
 }
 
-static void generateFactor(Factor *factor) {
+static void generateFactor(GeneratorState *generator, Factor *factor) {
 	switch (factor->type) {
 		case FACTOR_EXPRESSION:
-			output("(");
-			generateExpression(factor->expression);
-			output(")");
+			output(generator, "(");
+			generateExpression(generator, factor->expression);
+			output(generator, ")");
 			break;
 		case FACTOR_CONSTANT:
-			generateConstant(factor->constant);
+			generateConstant(generator, factor->constant);
 			break;
 	}
 }
 
-static void generateConstant(Constant *constant) {
+static void generateConstant(GeneratorState *generator, Constant *constant) {
 	switch (constant->type) {
 		case CONSTANT_INTEGER:
-			output("%d", constant->value);
+		case CONSTANT_FOLDED:
+			generateNumber(generator, constant->number, false);
 			break;
 		case CONSTANT_VARIABLE:
-			generateAssignable(constant->variable);
+			generateAssignable(generator, constant->variable);
 			break;
 		case CONSTANT_BOOLEAN:
-			output("%s", constant->value ? "true" : "false");
+			output(generator, "%s", constant->value ? "true" : "false");
 			break;
 		case CONSTANT_STRING:
-			output("%s", constant->string);
+			output(generator, "%s", constant->string);
 			break;
 		case CONSTANT_ADDRESS:
+			output(generator, "%s", constant->string);
+			break;
 		case CONSTANT_SCIENTIFIC_NOTATION:
-			output("%s", constant->string);
+			generateNumber(generator, constant->number, true);
 			break;
 	}
 }
 
-static void generateAssignable(Assignable *assignable) {
-	output("%s", assignable->identifier);
+// An exact number, in decimal. In scientific notation, its trailing zeros become the exponent (e.g., `.25e2` is `25`, and `2.5e18` is `25e17`).
+static void generateNumber(GeneratorState *generator, Number *number, boolean scientific) {
+	char digits[UINT256_DECIMAL_LENGTH + 1];
+	size_t length = uint256ToDecimal(&number->magnitude, digits);
+	size_t exponent = 0;
+	while (scientific && length > 1 && digits[length - 1] == '0') --length, ++exponent;
+	digits[length] = '\0';
+
+	output(generator, "%s%s", number->negative ? "-" : "", digits);
+	if (exponent > 0) output(generator, "e%zu", exponent);
+}
+
+static void generateAssignable(GeneratorState *generator, Assignable *assignable) {
+	output(generator, assignable->cached ? "%s$cached" : "%s", assignable->identifier);
 	if (assignable->type == ASSIGNABLE_ARRAY) {
-		output("[");
-		generateExpression(assignable->arrayIndex);
-		output("]");
+		output(generator, "[");
+		generateExpression(generator, assignable->arrayIndex);
+		output(generator, "]");
 	}
 }
@@ -2,7 +2,24 @@
 #define GENERATOR_HEADER
 
 #include "../support/shared.h"
+#include "../support/output-buffer.h"
 
-void Generator();
+// Generates the program in "state" and writes it to "outputFile".
+void Generator(CompilerState *state, FILE *outputFile);
+
+// Generates the program in "state" and appends it to "target".
+void GenerateToBuffer(CompilerState *state, OutputBuffer *target);
+
+// State of a generation in progress, for the built-in functions that generate their own code.
+typedef struct GeneratorState GeneratorState;
+
+// Appends formatted code, indented like the rest of the program.
+void GenerateOutput(GeneratorState *generator, const char *format, ...);
+
+// Appends the arguments of a call, separated by commas.
+void GenerateArguments(GeneratorState *generator, Arguments *arguments);
+
+// Appends an expression.
+void GenerateExpression(GeneratorState *generator, Expression *expression);
 
 #endif
@@ -1,42 +1,95 @@
+#include <string.h>
 #include "builtins.h"
 #include "../semantic-analysis/abstract-syntax-tree.h"
 
-const char *BUILT_IN_FUNCTIONS[] = {
-    // ERC20 and ERC721 members
-    "transfer",
-    // Built-in functions
-    "transferEth",
-    "balance",
-    "log",
-    "createProxyTo"
-};
+/**
+ * Implementación de "builtins.h".
+ *
+ * Los nombres se ubican con un hash perfecto calculado en tiempo de compilación
+ * a partir de su largo y de su primer y último caracter, de modo que encontrar
+ * una función built-in es un acceso a la tabla y una comparación. Si dos
+ * entradas cayeran en la misma posición, "builtInSlotsAreUnique" no compila.
+ */
+
+#define BUILT_IN_TABLE_SIZE 16
+#define BUILT_IN_SLOT(length, first, last) (((length) + 3 * (first) + (last)) & (BUILT_IN_TABLE_SIZE - 1))
+
+static void generateTransferEth(GeneratorState *generator, FunctionCall *functionCall);
+static void generateBalance(GeneratorState *generator, FunctionCall *functionCall);
+static void generateLog(GeneratorState *generator, FunctionCall *functionCall);
+static void generateCreateProxyTo(GeneratorState *generator, FunctionCall *functionCall);
+
+// name, length, first and last character, FunctionCallType, return type, import, code generator, calls out, gas
+#define BUILT_INS(BUILT_IN) \
+    /* ERC20 and ERC721 members */ \
+    BUILT_IN("transfer", 8, 't', 'r', FUNCTION_CALL_WITH_ARGS, DATA_TYPE_VOID, LIBRARY_NONE, NULL, true, 35000) \
+    /* Built-in functions (these are transformed during code generation) */ \
+    BUILT_IN("transferEth", 11, 't', 'h', BUILT_IN_TRANSFER_ETH, DATA_TYPE_VOID, LIBRARY_NONE, generateTransferEth, true, 12000) \
+    BUILT_IN("balance", 7, 'b', 'e', BUILT_IN_BALANCE, DATA_TYPE_UINT, LIBRARY_NONE, generateBalance, false, 2600) \
+    BUILT_IN("log", 3, 'l', 'g', BUILT_IN_LOG, DATA_TYPE_VOID, LIBRARY_CONSOLE, generateLog, false, 2800) \
+    BUILT_IN("createProxyTo", 13, 'c', 'o', BUILT_IN_CREATE_PROXY_TO, DATA_TYPE_ADDRESS, LIBRARY_CLONES, generateCreateProxyTo, false, 41000)
+
+#define BUILT_IN_ENTRY(name, length, first, last, type, returnType, library, generate, callsOut, gasCost) \
+    [BUILT_IN_SLOT(length, first, last)] = { name, length, type, returnType, library, generate, callsOut, gasCost },
 
-const FunctionCallType BUILT_IN_FUNCTION_TYPES[] = {
-    // ERC20 and ERC721 members
-    FUNCTION_CALL_WITH_ARGS,
-    // Built-in functions (these are transformed during code generation)
-    BUILT_IN_TRANSFER_ETH,
-    BUILT_IN_BALANCE,
-    BUILT_IN_LOG,
-    BUILT_IN_CREATE_PROXY_TO
+static const BuiltIn BUILT_IN_TABLE[BUILT_IN_TABLE_SIZE] = {
+    BUILT_INS(BUILT_IN_ENTRY)
 };
 
-boolean isBuiltInFunction(char *name) {
-    for (int i = 0; i < sizeof(BUILT_IN_FUNCTIONS) / sizeof(char *); ++i) {
-        if (strcmp(BUILT_IN_FUNCTIONS[i], name) == 0) {
-            if (strcmp("createProxyTo", name) == 0) state.libraries[LIBRARY_CLONES] = true;
-            else if (strcmp("log", name) == 0) state.libraries[LIBRARY_CONSOLE] = true;
-            return true;
-        }
+#define BUILT_IN_CASE(name, length, first, last, type, returnType, library, generate, callsOut, gasCost) \
+    case BUILT_IN_SLOT(length, first, last):
+
+// Never called: a repeated case label (i.e., a collision) is a compilation error.
+static inline __attribute__((unused)) void builtInSlotsAreUnique(int slot) {
+    switch (slot) {
+        BUILT_INS(BUILT_IN_CASE)
+            break;
     }
-    return false;
 }
 
-FunctionCallType getBuiltInType(char *name) {
-    for (int i = 0; i < sizeof(BUILT_IN_FUNCTIONS) / sizeof(char *); ++i) {
-        if (strcmp(BUILT_IN_FUNCTIONS[i], name) == 0) {
-            return BUILT_IN_FUNCTION_TYPES[i];
-        }
-    }
-    return -1;
+const BuiltIn *findBuiltIn(const char *name) {
+    const int length = (int) internedStringLength(name);
+    if (length == 0) return NULL;
+
+    const BuiltIn *builtIn = &BUILT_IN_TABLE[BUILT_IN_SLOT(length, name[0], name[length - 1])];
+    if (builtIn->name == NULL || builtIn->length != length || memcmp(builtIn->name, name, length) != 0)
+        return NULL;
+    return builtIn;
+}
+
+static void generateTransferEth(GeneratorState *generator, FunctionCall *functionCall) {
+    Expression *addressArg = functionCall->arguments->expressions[0];
+    Expression *amountArg = functionCall->arguments->expressions[1];
+
+    char *address;
+
+    if (addressArg->factor->constant->type == CONSTANT_ADDRESS)
+        address = addressArg->factor->constant->string;
+    else
+        address = addressArg->factor->constant->variable->identifier;
+
+    // The amount may be a literal, or an operation already folded into one
+    GenerateOutput(generator, "(bool s, ) = address(%s).call{value: ", address);
+    GenerateExpression(generator, amountArg);
+    GenerateOutput(generator, "%s(\"\");\n", "}"); // a '}' at the start of the format would close an indentation level
+
+    GenerateOutput(generator, "require(s, \"ETH transfer failed\")");
+}
+
+static void generateBalance(GeneratorState *generator, FunctionCall *functionCall) {
+    GenerateOutput(generator, "address(");
+    GenerateArguments(generator, functionCall->arguments);
+    GenerateOutput(generator, ").balance");
+}
+
+static void generateLog(GeneratorState *generator, FunctionCall *functionCall) {
+    GenerateOutput(generator, "console.log(");
+    GenerateArguments(generator, functionCall->arguments);
+    GenerateOutput(generator, ")");
+}
+
+static void generateCreateProxyTo(GeneratorState *generator, FunctionCall *functionCall) {
+    GenerateOutput(generator, "Clones.clone(address(");
+    GenerateArguments(generator, functionCall->arguments);
+    GenerateOutput(generator, "))");
 }
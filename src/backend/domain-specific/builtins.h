@@ -2,8 +2,40 @@
 #define BUILTINS_H
 
 #include "../support/shared.h"
+#include "../code-generation/generator.h"
 
-boolean isBuiltInFunction(char *name);
-FunctionCallType getBuiltInType(char *name);
+/**
+ * Registro de las funciones built-in (y de los miembros de ERC20 y ERC721).
+ * Cada una se describe con una única entrada en "builtins.c", que indica cómo
+ * se tipa, qué import requiere y cómo se genera su código.
+ */
+
+// Genera el código de una llamada a la función built-in.
+typedef void (*BuiltInGenerator)(GeneratorState *generator, FunctionCall *functionCall);
+
+struct BuiltIn {
+	const char *name;
+	int length;
+
+	// Tipo de las llamadas (FunctionCallType), y tipo de su resultado (DataTypeType).
+	FunctionCallType type;
+	DataTypeType returnType;
+
+	// Import que necesita el programa que la usa (LIBRARY_NONE si no requiere ninguno).
+	Library library;
+
+	// NULL si se genera como una llamada común: "name(arguments)".
+	BuiltInGenerator generate;
+
+	// Si llama a otro contrato (que podría, a su vez, modificar el estado de este).
+	boolean callsOut;
+
+	// Estimación estática del gas que consume una llamada (sin contar sus argumentos),
+	// que se suma en las estadísticas de la compilación (ver "builtInGas").
+	int gasCost;
+};
+
+// La función built-in "name" (un string internado), o NULL si no existe. Es O(1).
+const BuiltIn *findBuiltIn(const char *name);
 
 #endif
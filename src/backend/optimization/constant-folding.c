@@ -0,0 +1,448 @@
+#include <stdlib.h>
+#include <string.h>
+#include "../semantic-analysis/semantic-analysis.h"
+#include "../support/uint256.h"
+#include "constant-folding.h"
+
+/**
+ * Implementación de "constant-folding.h".
+ */
+
+/**
+ * Value of a constant expression. Numbers are kept as a sign and a magnitude,
+ * so that every operation is computed exactly, and the result is checked
+ * afterwards against the range of its type.
+ *
+ * Solidity computes an expression of literals as an exact rational number,
+ * whose intermediate results may be fractions or lie outside the range of any
+ * type (e.g., `(7 / 2) * 2` is 7, and `2 ** 256 - 1` is a valid "uint"). When
+ * a step is not an exact integer of 256 bits, the value is unknown and the
+ * expression is left to the Solidity compiler.
+ */
+typedef struct {
+	uint8_t type;       // DATA_TYPE_UINT, DATA_TYPE_INT o DATA_TYPE_BOOLEAN
+	boolean negative;
+	UInt256 magnitude;  // 0 o 1 en un booleano
+	boolean exact;      // every step is an exact integer of 256 bits, so the value is known
+	boolean foldable;   // it is also known that every step fits its type, so it can be replaced
+} Value;
+
+static boolean foldExpression(CompilerState *state, Expression *expression, Value *value);
+static void foldBlock(CompilerState *state, FunctionBlock *block);
+
+static void setNumber(Value *value, uint8_t type, boolean negative, const UInt256 *magnitude) {
+	value->type = type;
+	value->magnitude = *magnitude;
+	value->negative = negative && !uint256IsZero(magnitude); // there is no -0
+	value->exact = true;
+	value->foldable = true;
+}
+
+static void setBoolean(Value *value, boolean truth) {
+	value->type = DATA_TYPE_BOOLEAN;
+	value->negative = false;
+	value->magnitude = uint256FromUInt64(truth ? 1 : 0);
+	value->exact = true;
+	value->foldable = true;
+}
+
+static void setUnknown(Value *value, uint8_t type) {
+	value->type = type;
+	value->negative = false;
+	value->magnitude = uint256FromUInt64(0);
+	value->exact = false;
+	value->foldable = false;
+}
+
+static boolean isTrue(const Value *value) {
+	return !uint256IsZero(&value->magnitude);
+}
+
+// Whether the exact "value" fits in its type: [0, 2^256) or [-2^255, 2^255).
+static boolean fitsInType(const Value *value) {
+	if (value->type == DATA_TYPE_BOOLEAN) return true;
+	if (value->type == DATA_TYPE_UINT) return !value->negative;
+	return uint256FitsInt(&value->magnitude, value->negative);
+}
+
+// Numbers of different sign compare by their sign, and numbers of the same sign by their magnitude.
+static int compareValues(const Value *a, const Value *b) {
+	if (a->negative != b->negative) return a->negative ? -1 : 1;
+	const int comparison = uint256Compare(&a->magnitude, &b->magnitude);
+	return a->negative ? -comparison : comparison;
+}
+
+// Adds two signed magnitudes. Returns false if the sum does not fit in 256 bits.
+static boolean addSigned(Value *result, uint8_t type, boolean aNegative, const UInt256 *a, boolean bNegative, const UInt256 *b) {
+	UInt256 magnitude;
+	if (aNegative == bNegative) {
+		if (!uint256Add(&magnitude, a, b)) return false;
+		setNumber(result, type, aNegative, &magnitude);
+	}
+	else if (uint256Compare(a, b) >= 0) {
+		uint256Subtract(&magnitude, a, b);
+		setNumber(result, type, aNegative, &magnitude);
+	}
+	else {
+		uint256Subtract(&magnitude, b, a);
+		setNumber(result, type, bNegative, &magnitude);
+	}
+	return true;
+}
+
+static boolean constantValue(Constant *constant, Value *value) {
+	switch (constant->type) {
+		case CONSTANT_INTEGER:
+		case CONSTANT_SCIENTIFIC_NOTATION:
+		case CONSTANT_FOLDED:
+			setNumber(value, constant->inferredType, constant->number->negative, &constant->number->magnitude);
+			return true;
+		case CONSTANT_BOOLEAN:
+			setBoolean(value, constant->value != 0);
+			return true;
+		default:
+			return false;
+	}
+}
+
+// Computes the arithmetic operation of "expression" on two exact values. The result is unknown if it is not an exact integer of 256 bits.
+static void evaluateArithmetic(Expression *expression, const Value *left, const Value *right, Value *result) {
+	const uint8_t type = expression->inferredType;
+	const boolean negative = left->negative != right->negative;
+	UInt256 magnitude;
+	boolean exact = true;
+
+	switch (expression->type) {
+		case EXPRESSION_ADDITION:
+			exact = addSigned(result, type, left->negative, &left->magnitude, right->negative, &right->magnitude);
+			break;
+		case EXPRESSION_SUBTRACTION:
+			exact = addSigned(result, type, left->negative, &left->magnitude, !right->negative, &right->magnitude);
+			break;
+		case EXPRESSION_MULTIPLICATION:
+			exact = uint256Multiply(&magnitude, &left->magnitude, &right->magnitude);
+			setNumber(result, type, negative, &magnitude);
+			break;
+		case EXPRESSION_DIVISION:
+		case EXPRESSION_MODULO: {
+			// The remainder takes the sign of the dividend, and a quotient with a remainder is a fraction
+			UInt256 remainder;
+			uint256Divide(&magnitude, &remainder, &left->magnitude, &right->magnitude);
+			if (expression->type == EXPRESSION_DIVISION) {
+				exact = uint256IsZero(&remainder);
+				setNumber(result, type, negative, &magnitude);
+			}
+			else setNumber(result, type, left->negative, &remainder);
+			break;
+		}
+		case EXPRESSION_EXPONENTIATION:
+			// A negative exponent is not an integer power
+			exact = !right->negative && uint256Power(&magnitude, &left->magnitude, &right->magnitude);
+			setNumber(result, type, left->negative && uint256IsOdd(&right->magnitude), &magnitude);
+			break;
+		default:
+			exact = false;
+			break;
+	}
+
+	if (!exact) setUnknown(result, type);
+}
+
+// Returns false (after reporting it) on a division by zero.
+static boolean evaluate(CompilerState *state, Expression *expression, const Value *left, const Value *right, Value *result) {
+	if ((expression->type == EXPRESSION_DIVISION || expression->type == EXPRESSION_MODULO)
+			&& right->exact && uint256IsZero(&right->magnitude)) {
+		addSemanticError(state, expression->line, "Division by zero in constant expression");
+		return false;
+	}
+	if (!left->exact || !right->exact) {
+		setUnknown(result, expression->inferredType);
+		return true;
+	}
+
+	switch (expression->type) {
+		case EXPRESSION_EQUALITY:
+			setBoolean(result, compareValues(left, right) == 0);
+			break;
+		case EXPRESSION_INEQUALITY:
+			setBoolean(result, compareValues(left, right) != 0);
+			break;
+		case EXPRESSION_LESS_THAN:
+			setBoolean(result, compareValues(left, right) < 0);
+			break;
+		case EXPRESSION_LESS_THAN_OR_EQUAL:
+			setBoolean(result, compareValues(left, right) <= 0);
+			break;
+		case EXPRESSION_GREATER_THAN:
+			setBoolean(result, compareValues(left, right) > 0);
+			break;
+		case EXPRESSION_GREATER_THAN_OR_EQUAL:
+			setBoolean(result, compareValues(left, right) >= 0);
+			break;
+		case EXPRESSION_AND:
+			setBoolean(result, isTrue(left) && isTrue(right));
+			break;
+		case EXPRESSION_OR:
+			setBoolean(result, isTrue(left) || isTrue(right));
+			break;
+		default:
+			evaluateArithmetic(expression, left, right, result);
+			break;
+	}
+
+	// Only an expression whose every step fits its type is replaced with its value
+	result->foldable = result->exact && left->foldable && right->foldable && fitsInType(result);
+	return true;
+}
+
+/**
+ * Reports a constant expression whose (known) value does not fit its type,
+ * once it is used as a whole: as an operand of the program, or along with a
+ * value that is not constant.
+ */
+static void checkRange(CompilerState *state, Expression *expression, const Value *value) {
+	if (value->exact && !fitsInType(value))
+		addSemanticError(state, expression->line, "Arithmetic overflow in constant expression");
+}
+
+// Turns "expression" into a constant factor with its "value", in place.
+static void replaceWithConstant(CompilerState *state, Expression *expression, const Value *value) {
+	Constant *constant = arenaAllocate(state->arena, sizeof(Constant));
+	constant->inferredType = value->type;
+	if (value->type == DATA_TYPE_BOOLEAN) {
+		constant->type = CONSTANT_BOOLEAN;
+		constant->value = isTrue(value);
+	}
+	else {
+		constant->type = CONSTANT_FOLDED;
+		constant->number = arenaAllocate(state->arena, sizeof(Number));
+		constant->number->magnitude = value->magnitude;
+		constant->number->negative = value->negative;
+	}
+
+	Factor *factor = arenaAllocate(state->arena, sizeof(Factor));
+	factor->type = FACTOR_CONSTANT;
+	factor->inferredType = constant->inferredType;
+	factor->constant = constant;
+
+	expression->type = EXPRESSION_FACTOR;
+	expression->factor = factor;
+}
+
+static boolean foldFactor(CompilerState *state, Factor *factor, Value *value) {
+	if (factor->type == FACTOR_CONSTANT)
+		return constantValue(factor->constant, value);
+
+	// The parentheses around a folded operation are no longer needed
+	const boolean operation = factor->expression->type != EXPRESSION_FACTOR;
+	if (!foldExpression(state, factor->expression, value)) return false;
+	if (operation && factor->expression->type == EXPRESSION_FACTOR) {
+		factor->type = FACTOR_CONSTANT;
+		factor->constant = factor->expression->factor->constant;
+	}
+	return true;
+}
+
+// Most operations of a chain walked without allocating memory.
+#define CHAIN_BUFFER_SIZE 32
+
+/**
+ * Folds the operation "expression" (not a factor) whose left operand, if
+ * "constantLeft", has the value "left". Returns true (and its value) if the
+ * whole operation is constant, even if it could not be folded.
+ */
+static boolean foldOperation(CompilerState *state, Expression *expression, boolean constantLeft, const Value *left, Value *value) {
+	Value right;
+	const boolean constantRight = foldExpression(state, expression->right, &right);
+
+	if (expression->type == EXPRESSION_NOT) {
+		if (!constantRight) return false;
+		if (right.exact) setBoolean(value, !isTrue(&right));
+		else setUnknown(value, DATA_TYPE_BOOLEAN);
+		value->foldable = right.foldable;
+	}
+	else if (!constantLeft || !constantRight) {
+		if (constantLeft) checkRange(state, expression->left, left);
+		if (constantRight) checkRange(state, expression->right, &right);
+		return false;
+	}
+	else if (!evaluate(state, expression, left, &right, value)) {
+		return false;
+	}
+
+	if (value->foldable) replaceWithConstant(state, expression, value);
+	return true;
+}
+
+/**
+ * Folds the constant operations within "expression". Returns true (and its
+ * value) if the whole expression is constant, even if it could not be folded.
+ *
+ * A chain of operations such as `x + x + ... + x` nests to the left, as deep
+ * as its number of terms, so the left operands are followed in a loop (and the
+ * chain is folded back from the innermost one) instead of recursively.
+ */
+static boolean foldExpression(CompilerState *state, Expression *expression, Value *value) {
+	if (expression == NULL) return false;
+
+	Expression *buffer[CHAIN_BUFFER_SIZE];
+	Expression **chain = buffer;
+	int count = 0, capacity = CHAIN_BUFFER_SIZE;
+	Expression *operand = expression;
+	while (operand->type != EXPRESSION_FACTOR && operand->left != NULL) {
+		if (count == capacity) {
+			capacity *= 2;
+			Expression **grown = chain == buffer ? malloc(capacity * sizeof(Expression *)) : realloc(chain, capacity * sizeof(Expression *));
+			if (grown == NULL) {
+				perror("Error growing an operation chain");
+				exit(EXIT_FAILURE);
+			}
+			if (chain == buffer) memcpy(grown, buffer, sizeof(buffer));
+			chain = grown;
+		}
+		chain[count++] = operand;
+		operand = operand->left;
+	}
+
+	Value left, result;
+	boolean constant = operand->type == EXPRESSION_FACTOR
+		? foldFactor(state, operand->factor, &left)
+		: foldOperation(state, operand, false, NULL, &left);
+	while (count > 0) {
+		constant = foldOperation(state, chain[--count], constant, &left, &result);
+		if (constant) left = result;
+	}
+
+	if (chain != buffer) free(chain);
+	if (constant) *value = left;
+	return constant;
+}
+
+static void foldOperand(CompilerState *state, Expression *expression) {
+	Value value;
+	if (foldExpression(state, expression, &value)) checkRange(state, expression, &value);
+}
+
+static void foldArguments(CompilerState *state, Arguments *arguments) {
+	for (int i = 0; i < arguments->count; ++i)
+		foldOperand(state, arguments->expressions[i]);
+}
+
+static void foldAssignable(CompilerState *state, Assignable *assignable) {
+	if (assignable->type == ASSIGNABLE_ARRAY)
+		foldOperand(state, assignable->arrayIndex);
+}
+
+static void foldDataType(CompilerState *state, DataType *dataType) {
+	for (; dataType->type == DATA_TYPE_ARRAY; dataType = dataType->dataType)
+		foldOperand(state, dataType->expression);
+}
+
+static void foldParameters(CompilerState *state, ParameterDefinition *parameterDefinition) {
+	if (parameterDefinition->type == PARAMETERS_DEFINITION_NO_PARAMS) return;
+	for (int i = 0; i < parameterDefinition->parameters->count; ++i)
+		foldDataType(state, parameterDefinition->parameters->parameters[i].dataType);
+}
+
+static void foldVariableDefinition(CompilerState *state, VariableDefinition *variableDefinition) {
+	foldDataType(state, variableDefinition->dataType);
+	if (variableDefinition->type == VARIABLE_DEFINITION_INIT_EXPRESSION)
+		foldOperand(state, variableDefinition->expression);
+	else if (variableDefinition->type == VARIABLE_DEFINITION_INIT_FUNCTION_CALL)
+		foldArguments(state, variableDefinition->functionCall->arguments);
+}
+
+static void foldAssignment(CompilerState *state, Assignment *assignment) {
+	if (assignment == NULL) return;
+	foldAssignable(state, assignment->assignable);
+	if (assignment->type == ASSIGNMENT_EXPRESSION)
+		foldOperand(state, assignment->expression);
+	else
+		foldArguments(state, assignment->functionCall->arguments);
+}
+
+static void foldMathAssignment(CompilerState *state, MathAssignment *mathAssignment) {
+	foldAssignable(state, mathAssignment->variable);
+	if (mathAssignment->type == MATH_ASSIGNMENT_OPERATOR)
+		foldOperand(state, mathAssignment->expression);
+}
+
+static void foldLoop(CompilerState *state, Loop *loop) {
+	LoopInitialization *initialization = loop->loopInitialization;
+	if (initialization->type == LOOP_INITIALIZATION_VARIABLE_DEFINITION && initialization->variable != NULL)
+		foldVariableDefinition(state, initialization->variable);
+	else if (initialization->type == LOOP_INITIALIZATION_ASSIGNMENT)
+		foldAssignment(state, initialization->assignment);
+	else if (initialization->type == LOOP_INITIALIZATION_MATH_ASSIGNMENT)
+		foldMathAssignment(state, initialization->mathAssignment);
+
+	foldOperand(state, loop->loopCondition->condition);
+
+	if (loop->loopIteration->type == LOOP_ITERATION_MATH_ASSIGNMENT)
+		foldMathAssignment(state, loop->loopIteration->mathAssignment);
+	else
+		foldAssignment(state, loop->loopIteration->assignment);
+
+	foldBlock(state, loop->functionBlock);
+}
+
+static void foldInstruction(CompilerState *state, FunctionInstruction *instruction) {
+	switch (instruction->type) {
+		case FUNCTION_INSTRUCTION_VARIABLE_DEFINITION:
+			foldVariableDefinition(state, instruction->variableDefinition);
+			break;
+		case FUNCTION_INSTRUCTION_CONDITIONAL:
+			foldOperand(state, instruction->conditional->condition);
+			foldBlock(state, instruction->conditional->ifBlock);
+			if (instruction->conditional->type == CONDITIONAL_WITH_ELSE)
+				foldBlock(state, instruction->conditional->elseBlock);
+			break;
+		case FUNCTION_INSTRUCTION_FUNCTION_CALL:
+			foldArguments(state, instruction->functionCall->arguments);
+			break;
+		case FUNCTION_INSTRUCTION_MEMBER_CALL:
+			foldAssignable(state, instruction->memberCall->instance);
+			foldArguments(state, instruction->memberCall->method->arguments);
+			break;
+		case FUNCTION_INSTRUCTION_EMIT_EVENT:
+			foldArguments(state, instruction->eventArgs);
+			break;
+		case FUNCTION_INSTRUCTION_ASSIGNMENT:
+			foldAssignment(state, instruction->assignment);
+			break;
+		case FUNCTION_INSTRUCTION_MATH_ASSIGNMENT:
+			foldMathAssignment(state, instruction->mathAssignment);
+			break;
+		case FUNCTION_INSTRUCTION_LOOP:
+			foldLoop(state, instruction->loop);
+			break;
+	}
+}
+
+static void foldBlock(CompilerState *state, FunctionBlock *block) {
+	for (int i = 0; i < block->instructions->count; ++i)
+		foldInstruction(state, block->instructions->instructions[i]);
+}
+
+boolean FoldConstants(CompilerState *state) {
+	ContractInstructions *instructions = state->program->contract->block->instructions;
+	const int previousErrors = state->errorCount;
+
+	for (int i = 0; i < instructions->count; ++i) {
+		ContractInstruction *instruction = instructions->instructions[i];
+		switch (instruction->type) {
+			case STATE_VARIABLE_DECLARATION:
+				foldVariableDefinition(state, instruction->variableDefinition);
+				break;
+			case FUNCTION_DECLARATION:
+				foldParameters(state, instruction->functionDefinition->parameterDefinition);
+				foldBlock(state, instruction->functionDefinition->functionBlock);
+				break;
+			case EVENT_DECLARATION:
+				foldParameters(state, instruction->eventParams);
+				break;
+		}
+	}
+
+	return state->errorCount == previousErrors;
+}
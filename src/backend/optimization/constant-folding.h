@@ -0,0 +1,23 @@
+#ifndef CONSTANT_FOLDING_HEADER
+#define CONSTANT_FOLDING_HEADER
+
+#include "../support/shared.h"
+
+/**
+ * Evaluates, before generating code, every operation whose operands are all
+ * literals (e.g., `2 ** 10 * 1e18` or `(3 + 4) > 5`), and replaces it with its
+ * result. Like the Solidity compiler, the arithmetic is exact: an operation is
+ * only folded if every step is an integer that fits its type (a "uint" in
+ * [0, 2^256) and an "int" in [-2^255, 2^255)). Otherwise, such as in
+ * `(7 / 2) * 2` or `3 - 5 + 10`, it is left as written.
+ *
+ * A constant expression whose final value does not fit its type (e.g.,
+ * `uint a = 3 - 5;`), or a division by zero, is reported as a compilation
+ * error.
+ *
+ * The pass runs on a program without semantic errors, once the types of its
+ * expressions are known. Returns false if it found errors.
+ */
+boolean FoldConstants(CompilerState *state);
+
+#endif
@@ -0,0 +1,236 @@
+#include "dead-code-elimination.h"
+
+/**
+ * Implementación de "dead-code-elimination.h".
+ */
+
+// What becomes of an instruction once its dead code is removed.
+typedef enum {
+	INSTRUCTION_KEPT,       // it stays (maybe simplified in place)
+	INSTRUCTION_REMOVED,    // it never has an effect
+	INSTRUCTION_INLINED     // it is replaced by the instructions of its only live block
+} InstructionOutcome;
+
+static void eliminateInBlock(CompilerState *state, FunctionBlock *block);
+
+// The literal `true` or `false` of "expression" (maybe within parentheses), or NULL.
+static Constant *booleanLiteralOf(Expression *expression) {
+	while (expression->type == EXPRESSION_FACTOR && expression->factor->type == FACTOR_EXPRESSION)
+		expression = expression->factor->expression;
+	if (expression->type != EXPRESSION_FACTOR) return NULL;
+
+	Constant *constant = expression->factor->constant;
+	return constant->type == CONSTANT_BOOLEAN ? constant : NULL;
+}
+
+// Whether evaluating "expression" may revert (on an overflow, a division by zero or an index out of bounds).
+static boolean canRevert(Expression *expression) {
+	switch (expression->type) {
+		case EXPRESSION_FACTOR:
+			if (expression->factor->type == FACTOR_EXPRESSION)
+				return canRevert(expression->factor->expression);
+			return expression->factor->constant->type == CONSTANT_VARIABLE
+				&& expression->factor->constant->variable->type == ASSIGNABLE_ARRAY;
+		case EXPRESSION_ADDITION:
+		case EXPRESSION_SUBTRACTION:
+		case EXPRESSION_MULTIPLICATION:
+		case EXPRESSION_DIVISION:
+		case EXPRESSION_MODULO:
+		case EXPRESSION_EXPONENTIATION:
+			return true;
+		case EXPRESSION_NOT:
+			return canRevert(expression->right);
+		default:
+			return canRevert(expression->left) || canRevert(expression->right);
+	}
+}
+
+static boolean declaresVariables(FunctionBlock *block) {
+	for (int i = 0; i < block->instructions->count; ++i) {
+		if (block->instructions->instructions[i]->type == FUNCTION_INSTRUCTION_VARIABLE_DEFINITION) return true;
+	}
+	return false;
+}
+
+// The instructions within "block", including those nested in conditionals and loops.
+static uint64_t countInstructions(FunctionBlock *block) {
+	uint64_t count = block->instructions->count;
+	for (int i = 0; i < block->instructions->count; ++i) {
+		FunctionInstruction *instruction = block->instructions->instructions[i];
+		if (instruction->type == FUNCTION_INSTRUCTION_LOOP)
+			count += countInstructions(instruction->loop->functionBlock);
+		else if (instruction->type == FUNCTION_INSTRUCTION_CONDITIONAL) {
+			count += countInstructions(instruction->conditional->ifBlock);
+			if (instruction->conditional->type == CONDITIONAL_WITH_ELSE)
+				count += countInstructions(instruction->conditional->elseBlock);
+		}
+	}
+	return count;
+}
+
+static void countDeadBlock(CompilerState *state, FunctionBlock *block) {
+	if (state->statistics != NULL && block != NULL) state->statistics->eliminatedInstructions += countInstructions(block);
+}
+
+static void countEmptyBlock(CompilerState *state) {
+	if (state->statistics != NULL) ++state->statistics->emptyBlocks;
+}
+
+// `!(condition)`, to swap the branches of a conditional.
+static Expression *negate(CompilerState *state, Expression *condition) {
+	if (condition->type != EXPRESSION_FACTOR) {
+		Factor *factor = arenaAllocate(state->arena, sizeof(Factor));
+		factor->type = FACTOR_EXPRESSION;
+		factor->inferredType = DATA_TYPE_BOOLEAN;
+		factor->expression = condition;
+
+		condition = arenaAllocate(state->arena, sizeof(Expression));
+		condition->type = EXPRESSION_FACTOR;
+		condition->inferredType = DATA_TYPE_BOOLEAN;
+		condition->factor = factor;
+	}
+
+	Expression *negation = arenaAllocate(state->arena, sizeof(Expression));
+	negation->type = EXPRESSION_NOT;
+	negation->inferredType = DATA_TYPE_BOOLEAN;
+	negation->right = condition;
+	return negation;
+}
+
+static InstructionOutcome eliminateInConditional(CompilerState *state, Conditional *conditional, FunctionBlock **inlined) {
+	eliminateInBlock(state, conditional->ifBlock);
+	if (conditional->type == CONDITIONAL_WITH_ELSE)
+		eliminateInBlock(state, conditional->elseBlock);
+	FunctionBlock *elseBlock = conditional->type == CONDITIONAL_WITH_ELSE ? conditional->elseBlock : NULL;
+
+	Constant *literal = booleanLiteralOf(conditional->condition);
+	if (literal != NULL) {
+		FunctionBlock *live = literal->value ? conditional->ifBlock : elseBlock;
+		if (state->statistics != NULL) ++state->statistics->deadBranches;
+		countDeadBlock(state, literal->value ? elseBlock : conditional->ifBlock);
+
+		if (live == NULL || live->instructions->count == 0) return INSTRUCTION_REMOVED;
+		if (!declaresVariables(live)) {
+			*inlined = live;
+			return INSTRUCTION_INLINED;
+		}
+
+		// Its variables keep their own scope, within an `if (true)`
+		literal->value = true;
+		conditional->type = CONDITIONAL_NO_ELSE;
+		conditional->ifBlock = live;
+		return INSTRUCTION_KEPT;
+	}
+
+	if (elseBlock != NULL && elseBlock->instructions->count == 0) {
+		conditional->type = CONDITIONAL_NO_ELSE;
+		countEmptyBlock(state);
+	}
+	if (conditional->ifBlock->instructions->count == 0) {
+		if (conditional->type == CONDITIONAL_WITH_ELSE) {
+			conditional->condition = negate(state, conditional->condition);
+			conditional->ifBlock = conditional->elseBlock;
+			conditional->type = CONDITIONAL_NO_ELSE;
+			countEmptyBlock(state);
+		}
+		else if (!canRevert(conditional->condition)) {
+			countEmptyBlock(state);
+			return INSTRUCTION_REMOVED;
+		}
+	}
+	return INSTRUCTION_KEPT;
+}
+
+// A loop whose condition is constant false only runs its initialization.
+static InstructionOutcome eliminateInLoop(CompilerState *state, FunctionInstruction *instruction) {
+	Loop *loop = instruction->loop;
+	eliminateInBlock(state, loop->functionBlock);
+
+	if (loop->loopCondition->type != LOOP_CONDITION_CONDITIONAL) return INSTRUCTION_KEPT;
+	Constant *literal = booleanLiteralOf(loop->loopCondition->condition);
+	if (literal == NULL || literal->value) return INSTRUCTION_KEPT;
+
+	LoopInitialization *initialization = loop->loopInitialization;
+	InstructionOutcome outcome = INSTRUCTION_REMOVED;
+	switch (initialization->type) {
+		case LOOP_INITIALIZATION_VARIABLE_DEFINITION: {
+			// The variable only lives within the loop, but its initializer must still run if it may revert
+			VariableDefinition *variable = initialization->variable;
+			if (variable->type == VARIABLE_DEFINITION_INIT_FUNCTION_CALL
+					|| (variable->type == VARIABLE_DEFINITION_INIT_EXPRESSION && canRevert(variable->expression)))
+				return INSTRUCTION_KEPT;
+			break;
+		}
+		case LOOP_INITIALIZATION_ASSIGNMENT:
+			instruction->type = FUNCTION_INSTRUCTION_ASSIGNMENT;
+			instruction->assignment = initialization->assignment;
+			outcome = INSTRUCTION_KEPT;
+			break;
+		case LOOP_INITIALIZATION_MATH_ASSIGNMENT:
+			instruction->type = FUNCTION_INSTRUCTION_MATH_ASSIGNMENT;
+			instruction->mathAssignment = initialization->mathAssignment;
+			outcome = INSTRUCTION_KEPT;
+			break;
+		default:
+			break;
+	}
+
+	if (state->statistics != NULL) ++state->statistics->deadLoops;
+	countDeadBlock(state, loop->functionBlock);
+	return outcome;
+}
+
+static InstructionOutcome eliminateInInstruction(CompilerState *state, FunctionInstruction *instruction, FunctionBlock **inlined) {
+	switch (instruction->type) {
+		case FUNCTION_INSTRUCTION_CONDITIONAL:
+			return eliminateInConditional(state, instruction->conditional, inlined);
+		case FUNCTION_INSTRUCTION_LOOP:
+			return eliminateInLoop(state, instruction);
+		default:
+			return INSTRUCTION_KEPT;
+	}
+}
+
+static void appendInstruction(CompilerState *state, FunctionInstructions *list, FunctionInstruction *instruction) {
+	if (list->count == list->capacity) {
+		const int capacity = list->capacity == 0 ? 4 : 2 * list->capacity;
+		list->instructions = arenaGrow(state->arena, list->instructions, list->capacity * sizeof(FunctionInstruction *), capacity * sizeof(FunctionInstruction *));
+		list->capacity = capacity;
+	}
+	list->instructions[list->count++] = instruction;
+}
+
+// Rewrites the instructions of "block" only from the first one that changes.
+static void eliminateInBlock(CompilerState *state, FunctionBlock *block) {
+	FunctionInstructions *instructions = block->instructions;
+	FunctionInstructions live = { NULL, 0, 0 };
+	boolean changed = false;
+
+	for (int i = 0; i < instructions->count; ++i) {
+		FunctionInstruction *instruction = instructions->instructions[i];
+		FunctionBlock *inlined = NULL;
+		const InstructionOutcome outcome = eliminateInInstruction(state, instruction, &inlined);
+		if (outcome == INSTRUCTION_KEPT && !changed) continue;
+
+		if (!changed) {
+			for (int j = 0; j < i; ++j) appendInstruction(state, &live, instructions->instructions[j]);
+			changed = true;
+		}
+		if (outcome == INSTRUCTION_KEPT)
+			appendInstruction(state, &live, instruction);
+		else if (outcome == INSTRUCTION_INLINED) {
+			for (int j = 0; j < inlined->instructions->count; ++j)
+				appendInstruction(state, &live, inlined->instructions->instructions[j]);
+		}
+	}
+
+	if (changed) *instructions = live;
+}
+
+void EliminateDeadCode(CompilerState *state) {
+	ContractInstructions *instructions = state->program->contract->block->instructions;
+	for (int i = 0; i < instructions->count; ++i) {
+		if (instructions->instructions[i]->type == FUNCTION_DECLARATION)
+			eliminateInBlock(state, instructions->instructions[i]->functionDefinition->functionBlock);
+	}
+}
@@ -0,0 +1,19 @@
+#ifndef DEAD_CODE_ELIMINATION_HEADER
+#define DEAD_CODE_ELIMINATION_HEADER
+
+#include "../support/shared.h"
+
+/**
+ * Removes the code that can never run, once the constants are folded (see
+ * "constant-folding.h"): the branch of a conditional whose condition is a
+ * constant (e.g., `if (false) { ... }`), a loop whose condition is constant
+ * false, and empty blocks. A conditional that keeps a single branch is
+ * replaced by its instructions, unless they declare variables (which would
+ * then leave their scope).
+ *
+ * Every removal is counted in the statistics of the compilation, if they are
+ * collected.
+ */
+void EliminateDeadCode(CompilerState *state);
+
+#endif
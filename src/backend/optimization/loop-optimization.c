@@ -0,0 +1,228 @@
+#include "../support/uint256.h"
+#include "loop-optimization.h"
+
+/**
+ * Implementación de "loop-optimization.h".
+ */
+
+// Most variables a bound may read and still be cached.
+#define MAX_BOUND_VARIABLES 8
+
+/**
+ * What the instructions of a loop may change: which of the "variables" they
+ * assign (including the elements of an array), whether they assign any array
+ * or element (which may be another name for an array of the bound), and
+ * whether they call a function, which may change any state variable, or any
+ * array it takes as an argument.
+ */
+typedef struct {
+	SymbolTableEntry *variables[MAX_BOUND_VARIABLES];
+	int count;
+	boolean written;
+	boolean writesArray;
+	boolean calls;
+} LoopEffects;
+
+static void optimizeBlock(FunctionBlock *block);
+static void scanBlock(FunctionBlock *block, LoopEffects *effects);
+
+// The variable read by "expression" if it is just that variable (e.g., `i`, maybe within parentheses), or NULL.
+static Assignable *variableOf(Expression *expression) {
+	while (expression->type == EXPRESSION_FACTOR && expression->factor->type == FACTOR_EXPRESSION)
+		expression = expression->factor->expression;
+	if (expression->type != EXPRESSION_FACTOR || expression->factor->constant->type != CONSTANT_VARIABLE)
+		return NULL;
+
+	Assignable *variable = expression->factor->constant->variable;
+	return variable->type == ASSIGNABLE_VARIABLE && variable->symbol != NULL ? variable : NULL;
+}
+
+static boolean isOne(Expression *expression) {
+	if (expression->type != EXPRESSION_FACTOR || expression->factor->type != FACTOR_CONSTANT) return false;
+	Number *number = expression->factor->constant->number;
+	const UInt256 one = uint256FromUInt64(1);
+	return (expression->factor->constant->type == CONSTANT_INTEGER || expression->factor->constant->type == CONSTANT_FOLDED)
+		&& !number->negative && uint256Compare(&number->magnitude, &one) == 0;
+}
+
+// +1 if "step" increments its variable by one, -1 if it decrements it by one, and 0 otherwise.
+static int directionOf(MathAssignment *step) {
+	switch (step->type) {
+		case MATH_ASSIGNMENT_INCREMENT:
+			return 1;
+		case MATH_ASSIGNMENT_DECREMENT:
+			return -1;
+		case MATH_ASSIGNMENT_OPERATOR:
+			if (!isOne(step->expression)) return 0;
+			if (step->operator->type == MATH_ASSIGNMENT_OP_ADD_EQUAL) return 1;
+			if (step->operator->type == MATH_ASSIGNMENT_OP_SUBTRACT_EQUAL) return -1;
+			return 0;
+		default:
+			return 0;
+	}
+}
+
+// Collects the variables read by "expression". Returns false if it reads too many, or "counter".
+static boolean collectVariables(Expression *expression, SymbolTableEntry *counter, LoopEffects *effects, boolean *readsState, boolean *readsArray) {
+	if (expression == NULL) return true;
+	if (expression->type != EXPRESSION_FACTOR)
+		return collectVariables(expression->left, counter, effects, readsState, readsArray)
+			&& collectVariables(expression->right, counter, effects, readsState, readsArray);
+
+	Factor *factor = expression->factor;
+	if (factor->type == FACTOR_EXPRESSION) return collectVariables(factor->expression, counter, effects, readsState, readsArray);
+	if (factor->constant->type != CONSTANT_VARIABLE) return true;
+
+	Assignable *variable = factor->constant->variable;
+	if (variable->symbol == NULL || variable->symbol == counter || effects->count == MAX_BOUND_VARIABLES) return false;
+	effects->variables[effects->count++] = variable->symbol;
+	if (variable->symbol->depth == 0 && !variable->cached) *readsState = true;
+	if (variable->symbol->symbolType == SYMBOL_TYPE_ARRAY) *readsArray = true;
+	return collectVariables(variable->arrayIndex, counter, effects, readsState, readsArray);
+}
+
+static void scanWrite(Assignable *assignable, LoopEffects *effects) {
+	if (assignable->type == ASSIGNABLE_ARRAY || (assignable->symbol != NULL && assignable->symbol->symbolType == SYMBOL_TYPE_ARRAY))
+		effects->writesArray = true;
+	for (int i = 0; i < effects->count; ++i) {
+		if (effects->variables[i] == assignable->symbol) effects->written = true;
+	}
+}
+
+static void scanAssignment(Assignment *assignment, LoopEffects *effects) {
+	if (assignment == NULL) return;
+	scanWrite(assignment->assignable, effects);
+	if (assignment->type == ASSIGNMENT_FUNCTION_CALL) effects->calls = true;
+}
+
+static void scanInstruction(FunctionInstruction *instruction, LoopEffects *effects) {
+	switch (instruction->type) {
+		case FUNCTION_INSTRUCTION_VARIABLE_DEFINITION:
+			if (instruction->variableDefinition->type == VARIABLE_DEFINITION_INIT_FUNCTION_CALL) effects->calls = true;
+			break;
+		case FUNCTION_INSTRUCTION_CONDITIONAL:
+			scanBlock(instruction->conditional->ifBlock, effects);
+			if (instruction->conditional->type == CONDITIONAL_WITH_ELSE)
+				scanBlock(instruction->conditional->elseBlock, effects);
+			break;
+		case FUNCTION_INSTRUCTION_FUNCTION_CALL:
+		case FUNCTION_INSTRUCTION_MEMBER_CALL:
+			effects->calls = true;
+			break;
+		case FUNCTION_INSTRUCTION_ASSIGNMENT:
+			scanAssignment(instruction->assignment, effects);
+			break;
+		case FUNCTION_INSTRUCTION_MATH_ASSIGNMENT:
+			scanWrite(instruction->mathAssignment->variable, effects);
+			break;
+		case FUNCTION_INSTRUCTION_LOOP: {
+			Loop *loop = instruction->loop;
+			if (loop->loopInitialization->type == LOOP_INITIALIZATION_ASSIGNMENT)
+				scanAssignment(loop->loopInitialization->assignment, effects);
+			else if (loop->loopInitialization->type == LOOP_INITIALIZATION_MATH_ASSIGNMENT)
+				scanWrite(loop->loopInitialization->mathAssignment->variable, effects);
+			if (loop->loopIteration->type == LOOP_ITERATION_ASSIGNMENT)
+				scanAssignment(loop->loopIteration->assignment, effects);
+			else if (loop->loopIteration->type == LOOP_ITERATION_MATH_ASSIGNMENT)
+				scanWrite(loop->loopIteration->mathAssignment->variable, effects);
+			scanBlock(loop->functionBlock, effects);
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+static void scanBlock(FunctionBlock *block, LoopEffects *effects) {
+	for (int i = 0; i < block->instructions->count && !effects->written; ++i)
+		scanInstruction(block->instructions->instructions[i], effects);
+}
+
+// Whether nothing in "loop" (besides its step, which only changes the counter) may change "bound".
+static boolean isInvariant(Loop *loop, Expression *bound, SymbolTableEntry *counter) {
+	LoopEffects effects = { .count = 0, .written = false, .writesArray = false, .calls = false };
+	boolean readsState = false, readsArray = false;
+	if (!collectVariables(bound, counter, &effects, &readsState, &readsArray)) return false;
+
+	// A bound of literals is already folded, and a local variable is as cheap to read as a cached copy
+	const boolean operation = bound->type != EXPRESSION_FACTOR || bound->factor->type == FACTOR_EXPRESSION;
+	if (effects.count == 0 || (!readsState && !operation)) return false;
+
+	// The bound is evaluated before the initialization, so it must not change it either
+	if (loop->loopInitialization->type == LOOP_INITIALIZATION_ASSIGNMENT)
+		scanAssignment(loop->loopInitialization->assignment, &effects);
+	else if (loop->loopInitialization->type == LOOP_INITIALIZATION_MATH_ASSIGNMENT)
+		scanWrite(loop->loopInitialization->mathAssignment->variable, &effects);
+	else if (loop->loopInitialization->type == LOOP_INITIALIZATION_VARIABLE_DEFINITION
+			&& loop->loopInitialization->variable->type == VARIABLE_DEFINITION_INIT_FUNCTION_CALL)
+		effects.calls = true;
+	scanBlock(loop->functionBlock, &effects);
+
+	// Arrays are passed by reference, and may have several names, so the writes
+	// to an array of the bound cannot be told apart from the others
+	return !effects.written && !(readsState && effects.calls) && !(readsArray && (effects.calls || effects.writesArray));
+}
+
+static void optimizeLoop(Loop *loop) {
+	optimizeBlock(loop->functionBlock);
+
+	if (loop->loopCondition->type != LOOP_CONDITION_CONDITIONAL || loop->loopIteration->type != LOOP_ITERATION_MATH_ASSIGNMENT)
+		return;
+	MathAssignment *step = loop->loopIteration->mathAssignment;
+	SymbolTableEntry *counter = step->variable->symbol;
+	const int direction = directionOf(step);
+	// A state variable may also change within a called function
+	if (direction == 0 || step->variable->type != ASSIGNABLE_VARIABLE || counter == NULL || counter->depth == 0
+			|| counter->symbolType != SYMBOL_TYPE_VARIABLE || (counter->type != DATA_TYPE_UINT && counter->type != DATA_TYPE_INT))
+		return;
+
+	// `bound > i` is the same as `i < bound`
+	Expression *condition = loop->loopCondition->condition;
+	if (condition->type != EXPRESSION_LESS_THAN && condition->type != EXPRESSION_GREATER_THAN) return;
+	Assignable *variable = variableOf(condition->left);
+	const boolean reversed = variable == NULL || variable->symbol != counter;
+	if (reversed) {
+		variable = variableOf(condition->right);
+		if (variable == NULL || variable->symbol != counter) return;
+	}
+	const boolean lessThan = (condition->type == EXPRESSION_LESS_THAN) != reversed;
+
+	// Strictly below a bound of its type, the counter can always take one more step (or above, one less)
+	Expression *bound = reversed ? condition->left : condition->right;
+	if (bound->inferredType != (int8_t) counter->type) return;
+	if ((direction > 0) != lessThan) return;
+
+	LoopEffects effects = { .variables = { counter }, .count = 1, .written = false, .writesArray = false, .calls = false };
+	scanBlock(loop->functionBlock, &effects);
+	if (effects.written) return;
+
+	// Only the condition of a counting loop is normalized, so the others are generated as written
+	if (reversed) {
+		condition->left = condition->right;
+		condition->right = bound;
+		condition->type = lessThan ? EXPRESSION_LESS_THAN : EXPRESSION_GREATER_THAN;
+	}
+	loop->uncheckedIteration = true;
+	loop->cachedBound = isInvariant(loop, bound, counter);
+}
+
+static void optimizeBlock(FunctionBlock *block) {
+	for (int i = 0; i < block->instructions->count; ++i) {
+		FunctionInstruction *instruction = block->instructions->instructions[i];
+		if (instruction->type == FUNCTION_INSTRUCTION_LOOP)
+			optimizeLoop(instruction->loop);
+		else if (instruction->type == FUNCTION_INSTRUCTION_CONDITIONAL) {
+			optimizeBlock(instruction->conditional->ifBlock);
+			if (instruction->conditional->type == CONDITIONAL_WITH_ELSE)
+				optimizeBlock(instruction->conditional->elseBlock);
+		}
+	}
+}
+
+void OptimizeLoops(CompilerState *state) {
+	ContractInstructions *instructions = state->program->contract->block->instructions;
+	for (int i = 0; i < instructions->count; ++i) {
+		if (instructions->instructions[i]->type == FUNCTION_DECLARATION)
+			optimizeBlock(instructions->instructions[i]->functionDefinition->functionBlock);
+	}
+}
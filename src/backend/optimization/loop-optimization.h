@@ -0,0 +1,25 @@
+#ifndef LOOP_OPTIMIZATION_HEADER
+#define LOOP_OPTIMIZATION_HEADER
+
+#include "../support/shared.h"
+
+/**
+ * Recognizes counting loops, i.e., `for (...; i < bound; i++)` (or `i += 1`,
+ * and `i > bound` with `i--` or `i -= 1`), where the body never assigns the
+ * counter. The condition of such a loop (and only of such a loop) is
+ * normalized to have the counter on its left.
+ *
+ * The counter of such a loop can not overflow: it is always strictly below
+ * (or above) a bound of its own type when it is incremented (or decremented).
+ * So the generator emits the step as `unchecked { ++i; }` at the end of the
+ * body, which skips the overflow check of Solidity 0.8 on every iteration.
+ *
+ * If the bound reads state variables or computes an operation, and nothing in
+ * the loop may change its value, it is also evaluated once, into a local
+ * variable, instead of on every iteration. Arrays are passed by reference and
+ * may be assigned to other variables, so a bound that reads an array is only
+ * cached if the loop neither calls a function nor assigns any array.
+ */
+void OptimizeLoops(CompilerState *state);
+
+#endif
@@ -0,0 +1,283 @@
+#include <stdlib.h>
+#include <string.h>
+#include "../domain-specific/builtins.h"
+#include "storage-caching.h"
+
+/**
+ * Implementación de "storage-caching.h".
+ */
+
+// Most operations of a chain walked without allocating memory.
+#define CHAIN_BUFFER_SIZE 32
+
+// How a function or loop uses a state variable.
+typedef struct {
+	SymbolTableEntry *symbol;
+	int reads; // a read within a loop counts twice, as it may happen many times
+	boolean written;
+} StorageUse;
+
+/**
+ * A walk over the instructions of a function or loop, which either collects
+ * the state variables they use, or (if "redirect" is not NULL) marks their
+ * reads of the variables in "redirect" to be made from the local copies.
+ */
+typedef struct {
+	CompilerState *state;
+	StorageUse *uses;
+	int count;
+	int capacity;
+	boolean calls; // whether they make a call that may assign a state variable
+	int weight;
+	const CachedVariables *redirect;
+} StorageWalk;
+
+static void walkBlock(StorageWalk *walk, FunctionBlock *block);
+static void walkExpression(StorageWalk *walk, Expression *expression);
+static void cacheInBlock(CompilerState *state, FunctionBlock *block);
+
+// Only the value types fit in a local variable without copying a whole array or string to memory.
+static boolean isCacheable(const SymbolTableEntry *symbol) {
+	if (symbol == NULL || symbol->depth != 0 || symbol->symbolType != SYMBOL_TYPE_VARIABLE) return false;
+	switch (symbol->type) {
+		case DATA_TYPE_ERC20:
+		case DATA_TYPE_ERC721:
+		case DATA_TYPE_BOOLEAN:
+		case DATA_TYPE_ADDRESS:
+		case DATA_TYPE_UINT:
+		case DATA_TYPE_INT:
+			return true;
+		default:
+			return false;
+	}
+}
+
+static boolean isCached(const CachedVariables *cached, const SymbolTableEntry *symbol) {
+	for (int i = 0; i < cached->count; ++i) {
+		if (cached->symbols[i] == symbol) return true;
+	}
+	return false;
+}
+
+static StorageUse *useOf(StorageWalk *walk, SymbolTableEntry *symbol) {
+	for (int i = 0; i < walk->count; ++i) {
+		if (walk->uses[i].symbol == symbol) return &walk->uses[i];
+	}
+	if (walk->count == walk->capacity) {
+		const int capacity = walk->capacity == 0 ? 4 : 2 * walk->capacity;
+		walk->uses = arenaGrow(walk->state->arena, walk->uses, walk->capacity * sizeof(StorageUse), capacity * sizeof(StorageUse));
+		walk->capacity = capacity;
+	}
+	StorageUse *use = &walk->uses[walk->count++];
+	use->symbol = symbol;
+	return use;
+}
+
+static void walkRead(StorageWalk *walk, Assignable *assignable) {
+	walkExpression(walk, assignable->arrayIndex);
+	if (assignable->cached || !isCacheable(assignable->symbol)) return;
+
+	if (walk->redirect != NULL) assignable->cached = isCached(walk->redirect, assignable->symbol);
+	else useOf(walk, assignable->symbol)->reads += walk->weight;
+}
+
+static void walkWrite(StorageWalk *walk, Assignable *assignable) {
+	walkExpression(walk, assignable->arrayIndex);
+	if (walk->redirect == NULL && isCacheable(assignable->symbol)) useOf(walk, assignable->symbol)->written = true;
+}
+
+// A chain of operations such as `x + x + ... + x` nests to the left, as deep as its number of terms, so its left operands are followed in a loop.
+static void walkExpression(StorageWalk *walk, Expression *expression) {
+	if (expression == NULL) return;
+
+	Expression *buffer[CHAIN_BUFFER_SIZE];
+	Expression **chain = buffer;
+	int count = 0, capacity = CHAIN_BUFFER_SIZE;
+	for (; expression->type != EXPRESSION_FACTOR && expression->left != NULL; expression = expression->left) {
+		if (count == capacity) {
+			capacity *= 2;
+			Expression **grown = chain == buffer ? malloc(capacity * sizeof(Expression *)) : realloc(chain, capacity * sizeof(Expression *));
+			if (grown == NULL) {
+				perror("Error growing an operation chain");
+				exit(EXIT_FAILURE);
+			}
+			if (chain == buffer) memcpy(grown, buffer, sizeof(buffer));
+			chain = grown;
+		}
+		chain[count++] = expression;
+	}
+
+	if (expression->type != EXPRESSION_FACTOR)
+		walkExpression(walk, expression->right);
+	else if (expression->factor->type == FACTOR_EXPRESSION)
+		walkExpression(walk, expression->factor->expression);
+	else if (expression->factor->constant->type == CONSTANT_VARIABLE)
+		walkRead(walk, expression->factor->constant->variable);
+	while (count > 0) walkExpression(walk, chain[--count]->right);
+
+	if (chain != buffer) free(chain);
+}
+
+static void walkArguments(StorageWalk *walk, Arguments *arguments) {
+	if (arguments == NULL) return;
+	for (int i = 0; i < arguments->count; ++i) walkExpression(walk, arguments->expressions[i]);
+}
+
+// A function of the contract, or a built-in that calls another contract, may assign any state variable.
+static void walkFunctionCall(StorageWalk *walk, FunctionCall *functionCall) {
+	if (functionCall->type == FUNCTION_CALL_WITH_ARGS || functionCall->builtIn != NULL)
+		walkArguments(walk, functionCall->arguments);
+	if (functionCall->builtIn == NULL || functionCall->builtIn->callsOut) walk->calls = true;
+}
+
+static void walkVariableDefinition(StorageWalk *walk, VariableDefinition *variable) {
+	for (DataType *dataType = variable->dataType; dataType != NULL; dataType = dataType->dataType)
+		walkExpression(walk, dataType->expression);
+	if (variable->type == VARIABLE_DEFINITION_INIT_EXPRESSION)
+		walkExpression(walk, variable->expression);
+	else if (variable->type == VARIABLE_DEFINITION_INIT_FUNCTION_CALL)
+		walkFunctionCall(walk, variable->functionCall);
+}
+
+static void walkAssignment(StorageWalk *walk, Assignment *assignment) {
+	walkWrite(walk, assignment->assignable);
+	if (assignment->type == ASSIGNMENT_EXPRESSION)
+		walkExpression(walk, assignment->expression);
+	else
+		walkFunctionCall(walk, assignment->functionCall);
+}
+
+static void walkMathAssignment(StorageWalk *walk, MathAssignment *mathAssignment) {
+	walkWrite(walk, mathAssignment->variable);
+	if (mathAssignment->type == MATH_ASSIGNMENT_OPERATOR)
+		walkExpression(walk, mathAssignment->expression);
+}
+
+// Everything within "loop" may run many times, except its initialization.
+static void walkLoop(StorageWalk *walk, Loop *loop) {
+	LoopInitialization *initialization = loop->loopInitialization;
+	if (initialization->type == LOOP_INITIALIZATION_VARIABLE_DEFINITION)
+		walkVariableDefinition(walk, initialization->variable);
+	else if (initialization->type == LOOP_INITIALIZATION_ASSIGNMENT)
+		walkAssignment(walk, initialization->assignment);
+	else if (initialization->type == LOOP_INITIALIZATION_MATH_ASSIGNMENT)
+		walkMathAssignment(walk, initialization->mathAssignment);
+
+	const int weight = walk->weight;
+	walk->weight = 2;
+	if (loop->loopCondition->type == LOOP_CONDITION_CONDITIONAL)
+		walkExpression(walk, loop->loopCondition->condition);
+	if (loop->loopIteration->type == LOOP_ITERATION_ASSIGNMENT)
+		walkAssignment(walk, loop->loopIteration->assignment);
+	else if (loop->loopIteration->type == LOOP_ITERATION_MATH_ASSIGNMENT)
+		walkMathAssignment(walk, loop->loopIteration->mathAssignment);
+	walkBlock(walk, loop->functionBlock);
+	walk->weight = weight;
+}
+
+static void walkInstruction(StorageWalk *walk, FunctionInstruction *instruction) {
+	switch (instruction->type) {
+		case FUNCTION_INSTRUCTION_VARIABLE_DEFINITION:
+			walkVariableDefinition(walk, instruction->variableDefinition);
+			break;
+		case FUNCTION_INSTRUCTION_CONDITIONAL:
+			walkExpression(walk, instruction->conditional->condition);
+			walkBlock(walk, instruction->conditional->ifBlock);
+			if (instruction->conditional->type == CONDITIONAL_WITH_ELSE)
+				walkBlock(walk, instruction->conditional->elseBlock);
+			break;
+		case FUNCTION_INSTRUCTION_FUNCTION_CALL:
+			walkFunctionCall(walk, instruction->functionCall);
+			break;
+		case FUNCTION_INSTRUCTION_MEMBER_CALL:
+			// A call to another contract
+			walkRead(walk, instruction->memberCall->instance);
+			walkFunctionCall(walk, instruction->memberCall->method);
+			walk->calls = true;
+			break;
+		case FUNCTION_INSTRUCTION_EMIT_EVENT:
+			walkArguments(walk, instruction->eventArgs);
+			break;
+		case FUNCTION_INSTRUCTION_ASSIGNMENT:
+			walkAssignment(walk, instruction->assignment);
+			break;
+		case FUNCTION_INSTRUCTION_MATH_ASSIGNMENT:
+			walkMathAssignment(walk, instruction->mathAssignment);
+			break;
+		case FUNCTION_INSTRUCTION_LOOP:
+			walkLoop(walk, instruction->loop);
+			break;
+	}
+}
+
+static void walkBlock(StorageWalk *walk, FunctionBlock *block) {
+	for (int i = 0; i < block->instructions->count; ++i)
+		walkInstruction(walk, block->instructions->instructions[i]);
+}
+
+/**
+ * The variables that "walk" found read more than once and never written, or
+ * NULL if there are none (or a call may write any of them).
+ */
+static CachedVariables *cacheableVariables(StorageWalk *walk) {
+	if (walk->calls) return NULL;
+
+	CachedVariables *cached = NULL;
+	for (int i = 0; i < walk->count; ++i) {
+		if (walk->uses[i].written || walk->uses[i].reads < 2) continue;
+		if (cached == NULL) cached = arenaAllocate(walk->state->arena, sizeof(CachedVariables));
+		if (cached->count == cached->capacity) {
+			const int capacity = cached->capacity == 0 ? 4 : 2 * cached->capacity;
+			cached->symbols = arenaGrow(walk->state->arena, cached->symbols, cached->capacity * sizeof(SymbolTableEntry *), capacity * sizeof(SymbolTableEntry *));
+			cached->capacity = capacity;
+		}
+		cached->symbols[cached->count++] = walk->uses[i].symbol;
+	}
+	return cached;
+}
+
+// Reads already redirected (to the copies of the function or an outer loop) are not counted again.
+static void cacheInLoop(CompilerState *state, Loop *loop) {
+	StorageWalk walk = { .state = state, .weight = 1 };
+	walkLoop(&walk, loop);
+	loop->cachedVariables = cacheableVariables(&walk);
+
+	if (loop->cachedVariables != NULL) {
+		StorageWalk redirect = { .state = state, .weight = 1, .redirect = loop->cachedVariables };
+		walkLoop(&redirect, loop);
+	}
+	cacheInBlock(state, loop->functionBlock);
+}
+
+static void cacheInBlock(CompilerState *state, FunctionBlock *block) {
+	for (int i = 0; i < block->instructions->count; ++i) {
+		FunctionInstruction *instruction = block->instructions->instructions[i];
+		if (instruction->type == FUNCTION_INSTRUCTION_LOOP)
+			cacheInLoop(state, instruction->loop);
+		else if (instruction->type == FUNCTION_INSTRUCTION_CONDITIONAL) {
+			cacheInBlock(state, instruction->conditional->ifBlock);
+			if (instruction->conditional->type == CONDITIONAL_WITH_ELSE)
+				cacheInBlock(state, instruction->conditional->elseBlock);
+		}
+	}
+}
+
+static void cacheInFunction(CompilerState *state, FunctionDefinition *function) {
+	StorageWalk walk = { .state = state, .weight = 1 };
+	walkBlock(&walk, function->functionBlock);
+	function->cachedVariables = cacheableVariables(&walk);
+
+	if (function->cachedVariables != NULL) {
+		StorageWalk redirect = { .state = state, .weight = 1, .redirect = function->cachedVariables };
+		walkBlock(&redirect, function->functionBlock);
+	}
+	cacheInBlock(state, function->functionBlock);
+}
+
+void CacheStorageReads(CompilerState *state) {
+	ContractInstructions *instructions = state->program->contract->block->instructions;
+	for (int i = 0; i < instructions->count; ++i) {
+		if (instructions->instructions[i]->type == FUNCTION_DECLARATION)
+			cacheInFunction(state, instructions->instructions[i]->functionDefinition);
+	}
+}
@@ -0,0 +1,21 @@
+#ifndef STORAGE_CACHING_HEADER
+#define STORAGE_CACHING_HEADER
+
+#include "../support/shared.h"
+
+/**
+ * Finds the state variables (of a value type) that a function reads more than
+ * once, or within a loop, but never assigns. Each of them is copied into a
+ * local variable when the function starts, and read from there: every read
+ * from storage (an SLOAD) but the first becomes a read from the stack.
+ *
+ * If a function does assign one of them, a loop that only reads it still gets
+ * its own copy, made right before the loop.
+ *
+ * Calls to functions of the contract (which may assign any state variable),
+ * to other contracts and `transferEth` prevent the caching of the function or
+ * loop that makes them.
+ */
+void CacheStorageReads(CompilerState *state);
+
+#endif
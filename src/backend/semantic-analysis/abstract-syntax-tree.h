@@ -1,6 +1,21 @@
 #ifndef ABSTRACT_SYNTAX_TREE_HEADER
 #define ABSTRACT_SYNTAX_TREE_HEADER
 
+#include <stdint.h>
+
+/**
+ * Los nodos guardan su tipo (el "type" de cada uno, según el enum que se indica
+ * al lado) en un único byte, y los hijos que son excluyentes entre sí según ese
+ * tipo comparten lugar en una unión anónima. Así, los nodos más frecuentes
+ * (expresiones, factores, constantes e instrucciones) ocupan entre 16 y 24
+ * bytes, y como cada tipo de nodo se reserva contiguo en la arena (ver
+ * "newNode"), un recorrido del AST toca pocas líneas de caché. Solo se debe
+ * leer el hijo que corresponde al tipo del nodo.
+ *
+ * Los nodos sobre los que el análisis semántico puede reportar un error guardan
+ * además la línea en la que se construyeron (ver "semantic-analysis.h"), que
+ * ocupa el relleno que deja el tipo antes del primer puntero.
+ */
 
 // Nodes types
 typedef struct Program Program;
@@ -13,6 +28,7 @@ typedef struct ContractInstruction ContractInstruction;
 typedef struct FunctionInstructions FunctionInstructions;
 typedef struct FunctionInstruction FunctionInstruction;
 typedef struct Loop Loop;
+typedef struct CachedVariables CachedVariables;
 typedef struct LoopInitialization LoopInitialization;
 typedef struct LoopCondition LoopCondition;
 typedef struct LoopIteration LoopIteration;
@@ -33,9 +49,48 @@ typedef struct Expression Expression;
 typedef struct Factor Factor;
 typedef struct Constant Constant;
 
-// Methods
+// Un símbolo de la tabla de símbolos (ver "shared.h").
+typedef struct SymbolTableEntry SymbolTableEntry;
 
-void freeAST(Program *program);
+// Una función built-in (ver "builtins.h").
+typedef struct BuiltIn BuiltIn;
+
+// Un entero exacto, de 256 bits y con signo (ver "uint256.h").
+typedef struct Number Number;
+
+// Identifica el tipo de cada nodo (p.ej., para contar los nodos creados).
+typedef enum {
+	NODE_PROGRAM,
+	NODE_CONTRACT_DEFINITION,
+	NODE_CONTRACT_BLOCK,
+	NODE_FUNCTION_BLOCK,
+	NODE_CONDITIONAL,
+	NODE_CONTRACT_INSTRUCTIONS,
+	NODE_CONTRACT_INSTRUCTION,
+	NODE_FUNCTION_INSTRUCTIONS,
+	NODE_FUNCTION_INSTRUCTION,
+	NODE_LOOP,
+	NODE_LOOP_INITIALIZATION,
+	NODE_LOOP_CONDITION,
+	NODE_LOOP_ITERATION,
+	NODE_ASSIGNABLE,
+	NODE_ASSIGNMENT,
+	NODE_MATH_ASSIGNMENT,
+	NODE_MATH_ASSIGNMENT_OPERATOR,
+	NODE_FUNCTION_CALL,
+	NODE_ARGUMENTS,
+	NODE_MEMBER_CALL,
+	NODE_VARIABLE_DEFINITION,
+	NODE_DATA_TYPE,
+	NODE_FUNCTION_DEFINITION,
+	NODE_DECORATORS,
+	NODE_PARAMETER_DEFINITION,
+	NODE_PARAMETERS,
+	NODE_EXPRESSION,
+	NODE_FACTOR,
+	NODE_CONSTANT,
+	NODE_TYPE_COUNT
+} NodeType;
 
 // Nodes
 
@@ -52,15 +107,12 @@ struct ContractBlock{
 	ContractInstructions *instructions;
 };
 
-typedef enum {
-	CONTRACT_INSTRUCTIONS_MULTIPLE,
-	CONTRACT_INSTRUCTIONS_EMPTY,
-} ContractInstructionsType;
-
+// Las listas se guardan como arreglos contiguos, en el orden del programa, de
+// modo que se recorren con un ciclo (y no con una llamada por elemento).
 struct ContractInstructions {
-	ContractInstructionsType type;
-	ContractInstructions *instructions;
-	ContractInstruction *instruction;
+	ContractInstruction **instructions;
+	int count;
+	int capacity;
 };
 
 typedef enum {
@@ -70,12 +122,19 @@ typedef enum {
 } ContractInstructionType;
 
 struct ContractInstruction{
-	ContractInstructionType type;
-	Decorators *variableDecorators;
-	VariableDefinition *variableDefinition;
-	FunctionDefinition *functionDefinition;
-	char *eventIdentifier;
-	ParameterDefinition *eventParams;
+	uint8_t type; // ContractInstructionType
+	int line; // línea del programa, para los diagnósticos
+	union {
+		struct {
+			Decorators *variableDecorators;
+			VariableDefinition *variableDefinition;
+		};
+		FunctionDefinition *functionDefinition;
+		struct {
+			char *eventIdentifier;
+			ParameterDefinition *eventParams;
+		};
+	};
 };
 
 typedef enum {
@@ -84,7 +143,7 @@ typedef enum {
 } DecoratorsType;
 
 struct Decorators {
-	DecoratorsType type;
+	uint8_t type; // DecoratorsType
 	Decorators *decorators;
 	char *decorator;
 };
@@ -99,22 +158,18 @@ typedef enum {
 } ConditionalType;
 
 struct Conditional{
-	ConditionalType type;
+	uint8_t type; // ConditionalType
+	int line; // línea del programa, para los diagnósticos
 	Expression *condition;
 	FunctionBlock *ifBlock;
 	FunctionBlock *elseBlock;
 };
 
 
-typedef enum {
-	FUNCTION_INSTRUCTIONS_MULTIPLE,
-	FUNCTION_INSTRUCTIONS_EMPTY,
-} FunctionInstructionsType;
-
 struct FunctionInstructions {
-	FunctionInstructionsType type;
-	FunctionInstructions *instructions;
-	FunctionInstruction *instruction;
+	FunctionInstruction **instructions;
+	int count;
+	int capacity;
 };
 
 typedef enum {
@@ -129,25 +184,40 @@ typedef enum {
 } FunctionInstructionType;
 
 struct FunctionInstruction{
-	FunctionInstructionType type;
-	VariableDefinition *variableDefinition;
-	Conditional *conditional;
-	FunctionCall *functionCall;
-	MemberCall *memberCall;
-	char *eventIdentifier;
-	Arguments *eventArgs;
-	Assignment *assignment;
-	MathAssignment *mathAssignment;
-	Loop *loop;
+	uint8_t type; // FunctionInstructionType
+	int line; // línea del programa, para los diagnósticos
+	union {
+		VariableDefinition *variableDefinition;
+		Conditional *conditional;
+		FunctionCall *functionCall;
+		MemberCall *memberCall;
+		struct {
+			char *eventIdentifier;
+			Arguments *eventArgs;
+		};
+		Assignment *assignment;
+		MathAssignment *mathAssignment;
+		Loop *loop;
+	};
 };
 
 struct Loop{
+	uint8_t uncheckedIteration; // el contador no puede desbordar (ver "loop-optimization.h")
+	uint8_t cachedBound; // la cota de la condición se evalúa una sola vez, antes del ciclo
+	CachedVariables *cachedVariables; // variables de estado copiadas antes del ciclo, o NULL
 	LoopInitialization *loopInitialization;
 	LoopCondition *loopCondition;
 	LoopIteration *loopIteration;
 	FunctionBlock *functionBlock;
 };
 
+// Variables de estado que se leen de una copia local, en lugar de desde el storage.
+struct CachedVariables {
+	SymbolTableEntry **symbols;
+	int count;
+	int capacity;
+};
+
 typedef enum {
 	LOOP_INITIALIZATION_VARIABLE_DEFINITION,
 	LOOP_INITIALIZATION_ASSIGNMENT,
@@ -156,10 +226,12 @@ typedef enum {
 } LoopInitializationType;
 
 struct LoopInitialization{
-	LoopInitializationType type;
-	VariableDefinition *variable;
-	Assignment *assignment;
-	MathAssignment *mathAssignment;
+	uint8_t type; // LoopInitializationType
+	union {
+		VariableDefinition *variable;
+		Assignment *assignment;
+		MathAssignment *mathAssignment;
+	};
 };
 
 typedef enum {
@@ -168,7 +240,7 @@ typedef enum {
 } LoopConditionType;
 
 struct LoopCondition{
-	LoopConditionType type;
+	uint8_t type; // LoopConditionType
 	struct Expression *condition;
 };
 
@@ -179,9 +251,11 @@ typedef enum {
 } LoopIterationType;
 
 struct LoopIteration{
-	LoopIterationType type;
-	Assignment *assignment;
-	MathAssignment *mathAssignment;
+	uint8_t type; // LoopIterationType
+	union {
+		Assignment *assignment;
+		MathAssignment *mathAssignment;
+	};
 };
 
 typedef enum {
@@ -190,9 +264,12 @@ typedef enum {
 } AssignableType;
 
 struct Assignable{
-	AssignableType type;
+	uint8_t type; // AssignableType
+	uint8_t cached; // se lee de su copia local (ver "storage-caching.h")
+	int line; // línea del programa, para los diagnósticos
 	Expression *arrayIndex;
 	char *identifier;
+	SymbolTableEntry *symbol; // resuelto por el análisis semántico, NULL si no existe
 };
 
 typedef enum {
@@ -201,10 +278,13 @@ typedef enum {
 } AssignmentType;
 
 struct Assignment{
-	AssignmentType type;
+	uint8_t type; // AssignmentType
+	int line; // línea del programa, para los diagnósticos
 	Assignable *assignable;
-	Expression *expression;
-	FunctionCall *functionCall;
+	union {
+		Expression *expression;
+		FunctionCall *functionCall;
+	};
 };
 
 typedef enum {
@@ -214,7 +294,8 @@ typedef enum {
 } MathAssignmentType;
 
 struct MathAssignment{
-	MathAssignmentType type;
+	uint8_t type; // MathAssignmentType
+	int line; // línea del programa, para los diagnósticos
 	Assignable *variable;
 	MathAssignmentOperator *operator;
 	Expression *expression;
@@ -229,7 +310,7 @@ typedef enum {
 } MathAssignmentOperatorType;
 
 struct MathAssignmentOperator{
-	MathAssignmentOperatorType type;
+	uint8_t type; // MathAssignmentOperatorType
 };
 
 typedef enum {
@@ -242,24 +323,22 @@ typedef enum {
 } FunctionCallType;
 
 struct FunctionCall{
-	FunctionCallType type;
+	uint8_t type; // FunctionCallType
+	int line; // línea del programa, para los diagnósticos
 	Arguments *arguments;
 	char *identifier;
+	SymbolTableEntry *symbol; // resuelto por el análisis semántico, NULL si no existe (o es built-in)
+	const BuiltIn *builtIn;   // NULL si no es una función built-in
 };
 
-typedef enum {
-	ARGUMENTS_MULTIPLE,
-	ARGUMENTS_SINGLE,
-	ARGUMENTS_EMPTY
-} ArgumentsType;
-
 struct Arguments {
-	ArgumentsType type;
-	Arguments *arguments;
-	Expression *expression;
+	Expression **expressions;
+	int count;
+	int capacity;
 };
 
 struct MemberCall{
+	int line; // línea del programa, para los diagnósticos
 	Assignable *instance;
 	FunctionCall *method;
 };
@@ -271,10 +350,13 @@ typedef enum VariableDefinitionType {
 } VariableDefinitionType;
 
 struct VariableDefinition{
-	VariableDefinitionType type;
+	uint8_t type; // VariableDefinitionType
+	int line; // línea del programa, para los diagnósticos
 	DataType *dataType;
-	Expression *expression;
-	FunctionCall *functionCall;
+	union {
+		Expression *expression;
+		FunctionCall *functionCall;
+	};
 	char *identifier;
 };
 
@@ -292,12 +374,15 @@ typedef enum {
 } DataTypeType;
 
 struct DataType {
-	DataTypeType type;
+	uint8_t type; // DataTypeType
+	int line; // línea del programa, para los diagnósticos
 	DataType *dataType;
 	Expression *expression;
 };
 
 struct FunctionDefinition{
+	int line; // línea del programa, para los diagnósticos
+	CachedVariables *cachedVariables; // variables de estado copiadas al inicio de la función, o NULL
 	Decorators *decorators;
 	ParameterDefinition *parameterDefinition;
 	FunctionBlock *functionBlock;
@@ -310,20 +395,20 @@ typedef enum {
 } ParameterDefinitionType;
 
 struct ParameterDefinition{
-	ParameterDefinitionType type;
+	uint8_t type; // ParameterDefinitionType
 	Parameters *parameters;
 };
 
-typedef enum {
-	PARAMETERS_MULTIPLE,
-	PARAMETERS_SINGLE
-} ParametersType;
-
-struct Parameters {
-	ParametersType type;
-	Parameters *parameters;
+typedef struct {
 	DataType *dataType;
 	char *identifier;
+	int line; // línea del programa, para los diagnósticos
+} Parameter;
+
+struct Parameters {
+	Parameter *parameters;
+	int count;
+	int capacity;
 };
 
 typedef enum {
@@ -346,10 +431,16 @@ typedef enum {
 } ExpressionType;
 
 struct Expression {
-	ExpressionType type;
-	Expression *left;
-	Expression *right;
-	Factor *factor;
+	uint8_t type; // ExpressionType
+	int8_t inferredType; // DataTypeType inferred by the semantic analysis, -1 if ill-typed
+	int line; // línea del programa, para los diagnósticos
+	union {
+		struct {
+			Expression *left; // NULL in EXPRESSION_NOT
+			Expression *right;
+		};
+		Factor *factor;
+	};
 };
 
 typedef enum {
@@ -358,9 +449,12 @@ typedef enum {
 } FactorType;
 
 struct Factor {
-	FactorType type;
-	Expression *expression;
-	Constant *constant;
+	uint8_t type; // FactorType
+	int8_t inferredType;
+	union {
+		Expression *expression;
+		Constant *constant;
+	};
 };
 
 typedef enum {
@@ -369,14 +463,19 @@ typedef enum {
 	CONSTANT_BOOLEAN,
 	CONSTANT_STRING,
 	CONSTANT_ADDRESS,
-	CONSTANT_SCIENTIFIC_NOTATION
+	CONSTANT_SCIENTIFIC_NOTATION,
+	CONSTANT_FOLDED
 } ConstantType;
 
 struct Constant{
-	ConstantType type;
-	Assignable *variable;
-	int value;
-	char *string;
+	uint8_t type; // ConstantType
+	int8_t inferredType;
+	union {
+		Assignable *variable;
+		int value; // CONSTANT_BOOLEAN
+		char *string;
+		Number *number; // CONSTANT_INTEGER, CONSTANT_SCIENTIFIC_NOTATION y CONSTANT_FOLDED (NULL si el literal no es un entero de 256 bits)
+	};
 };
 
 #endif
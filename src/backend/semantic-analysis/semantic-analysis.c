@@ -0,0 +1,482 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../domain-specific/builtins.h"
+#include "../support/thread-pool.h"
+#include "symbol-table.h"
+#include "type-checking.h"
+#include "semantic-analysis.h"
+
+/**
+ * Implementación de "semantic-analysis.h".
+ */
+
+#define MAX_ERROR_LENGTH 150
+
+// Cantidad de operaciones de una cadena que se recorren sin reservar memoria.
+#define CHAIN_BUFFER_SIZE 32
+
+static void analyzeExpression(CompilerState *state, Expression *expression);
+static void analyzeBlock(CompilerState *state, FunctionBlock *block);
+
+void addSemanticError(CompilerState *state, int line, const char *format, ...) {
+    if (state->errorCount == MAX_ERRORS) return;
+
+    char message[MAX_ERROR_LENGTH];
+    va_list arguments;
+    va_start(arguments, format);
+    vsnprintf(message, MAX_ERROR_LENGTH, format, arguments);
+    va_end(arguments);
+
+    Diagnostic *error = &state->errors[state->errorCount++];
+    error->type = DIAGNOSTIC_SEMANTIC_ERROR;
+    error->line = line;
+    error->message = strdup(message);
+    error->lexeme = NULL;
+}
+
+// Las declaraciones se chequean antes que los cuerpos, así que los errores se
+// ordenan por línea (de forma estable) para reportarlos en el orden del programa.
+static void sortErrorsByLine(CompilerState *state) {
+    for (int i = 1; i < state->errorCount; ++i) {
+        Diagnostic error = state->errors[i];
+        int j = i;
+        for (; j > 0 && state->errors[j - 1].line > error.line; --j)
+            state->errors[j] = state->errors[j - 1];
+        state->errors[j] = error;
+    }
+}
+
+// Declara una variable (o un arreglo, cuyo tipo es el de sus elementos) en el scope actual.
+static SymbolTableEntry *declareVariable(CompilerState *state, char *identifier, DataType *dataType) {
+    if (dataType->type != DATA_TYPE_ARRAY)
+        return declareSymbol(state, identifier, dataType->type, SYMBOL_TYPE_VARIABLE);
+
+    DataType *elementType = dataType;
+    while (elementType->type == DATA_TYPE_ARRAY)
+        elementType = elementType->dataType;
+    return declareSymbol(state, identifier, elementType->type, SYMBOL_TYPE_ARRAY);
+}
+
+static void analyzeAssignable(CompilerState *state, Assignable *assignable) {
+    analyzeExpression(state, assignable->arrayIndex);
+    assignable->symbol = lookupSymbol(state, assignable->identifier);
+    if (assignable->symbol == NULL)
+        addSemanticError(state, assignable->line, "Variable `%s` does not exist", assignable->identifier);
+}
+
+static void analyzeConstant(CompilerState *state, Constant *constant) {
+    if (constant->type == CONSTANT_VARIABLE)
+        analyzeAssignable(state, constant->variable);
+    constant->inferredType = inferConstantType(state, constant);
+}
+
+static void analyzeFactor(CompilerState *state, Factor *factor) {
+    if (factor->type == FACTOR_EXPRESSION)
+        analyzeExpression(state, factor->expression);
+    else
+        analyzeConstant(state, factor->constant);
+    factor->inferredType = inferFactorType(factor);
+}
+
+// Un literal numérico que el scanner no pudo representar (p.ej., `1e100` o `1.5e0`).
+static boolean isOutOfRange(Factor *factor) {
+    if (factor->type != FACTOR_CONSTANT) return false;
+    Constant *constant = factor->constant;
+    return (constant->type == CONSTANT_INTEGER || constant->type == CONSTANT_SCIENTIFIC_NOTATION) && constant->number == NULL;
+}
+
+// Infiere el tipo de una operación, luego de inferir el de sus operandos.
+static void analyzeOperation(CompilerState *state, Expression *expression) {
+    analyzeExpression(state, expression->right);
+    expression->inferredType = inferExpressionType(expression);
+    if (expression->inferredType == -1)
+        addSemanticError(state, expression->line, "Operation between incompatible types");
+}
+
+// Infiere el tipo de la expresión luego de inferir el de sus hijos. Una cadena
+// de operaciones como `x + x + ... + x` se anida hacia la izquierda, tan hondo
+// como términos tiene, así que sus operandos izquierdos se recorren en un ciclo
+// (y la cadena se analiza de vuelta desde el más interno) y no recursivamente.
+static void analyzeExpression(CompilerState *state, Expression *expression) {
+    if (expression == NULL) return;
+
+    Expression *buffer[CHAIN_BUFFER_SIZE];
+    Expression **chain = buffer;
+    int count = 0, capacity = CHAIN_BUFFER_SIZE;
+    for (; expression->type != EXPRESSION_FACTOR && expression->left != NULL; expression = expression->left) {
+        if (count == capacity) {
+            capacity *= 2;
+            Expression **grown = chain == buffer ? malloc(capacity * sizeof(Expression *)) : realloc(chain, capacity * sizeof(Expression *));
+            if (grown == NULL) {
+                perror("Error growing an operation chain");
+                exit(EXIT_FAILURE);
+            }
+            if (chain == buffer) memcpy(grown, buffer, sizeof(buffer));
+            chain = grown;
+        }
+        chain[count++] = expression;
+    }
+
+    if (expression->type == EXPRESSION_FACTOR) {
+        analyzeFactor(state, expression->factor);
+        expression->inferredType = inferExpressionType(expression);
+        if (isOutOfRange(expression->factor))
+            addSemanticError(state, expression->line, "Number literal is not an integer of 256 bits");
+    }
+    else analyzeOperation(state, expression);
+    while (count > 0) analyzeOperation(state, chain[--count]);
+
+    if (chain != buffer) free(chain);
+}
+
+static void analyzeArguments(CompilerState *state, Arguments *arguments) {
+    for (int i = 0; i < arguments->count; ++i)
+        analyzeExpression(state, arguments->expressions[i]);
+}
+
+static void analyzeFunctionCall(CompilerState *state, FunctionCall *functionCall) {
+    analyzeArguments(state, functionCall->arguments);
+
+    const BuiltIn *builtIn = functionCall->builtIn;
+    functionCall->symbol = lookupSymbol(state, functionCall->identifier);
+    if (functionCall->symbol == NULL && builtIn == NULL)
+        addSemanticError(state, functionCall->line, "Function `%s` does not exist", functionCall->identifier);
+
+    // The program imports whatever its built-in calls need
+    if (builtIn != NULL && builtIn->library != LIBRARY_NONE)
+        state->libraries[builtIn->library] = true;
+    if (builtIn != NULL && state->statistics != NULL)
+        state->statistics->builtInGas += builtIn->gasCost;
+
+    if (typeFunctionCall(state, functionCall) == -1)
+        addSemanticError(state, functionCall->line, "%s is not callable", functionCall->identifier);
+}
+
+static void analyzeMemberCall(CompilerState *state, MemberCall *memberCall) {
+    analyzeAssignable(state, memberCall->instance);
+    analyzeFunctionCall(state, memberCall->method);
+    if (typeMemberCall(state, memberCall) == -1)
+        addSemanticError(state, memberCall->line, "Invalid function call");
+}
+
+static void analyzeAssignment(CompilerState *state, Assignment *assignment) {
+    if (assignment == NULL) return;
+
+    analyzeAssignable(state, assignment->assignable);
+    if (assignment->type == ASSIGNMENT_FUNCTION_CALL) {
+        analyzeFunctionCall(state, assignment->functionCall);
+        return;
+    }
+
+    analyzeExpression(state, assignment->expression);
+    if (typeAssignment(state, assignment) == -1)
+        addSemanticError(state, assignment->line, "Invalid assignment to variable");
+}
+
+static void analyzeMathAssignment(CompilerState *state, MathAssignment *mathAssignment) {
+    analyzeAssignable(state, mathAssignment->variable);
+    if (mathAssignment->type == MATH_ASSIGNMENT_OPERATOR)
+        analyzeExpression(state, mathAssignment->expression);
+    if (typeMathAssignment(state, mathAssignment) == -1)
+        addSemanticError(state, mathAssignment->line, "Can not apply math operators to variable");
+}
+
+static void analyzeDataType(CompilerState *state, DataType *dataType) {
+    if (dataType->type != DATA_TYPE_ARRAY) return;
+
+    analyzeDataType(state, dataType->dataType);
+    analyzeExpression(state, dataType->expression);
+    if (typeExpression(dataType->expression) != DATA_TYPE_UINT)
+        addSemanticError(state, dataType->line, "Invalid array size in array initialization.");
+}
+
+// Only declarations without an initializer declare arrays by their element type.
+static void declareVariableDefinition(CompilerState *state, VariableDefinition *variableDefinition) {
+    SymbolTableEntry *symbol = variableDefinition->type == VARIABLE_DEFINITION_DECLARATION
+        ? declareVariable(state, variableDefinition->identifier, variableDefinition->dataType)
+        : declareSymbol(state, variableDefinition->identifier, variableDefinition->dataType->type, SYMBOL_TYPE_VARIABLE);
+    if (symbol == NULL)
+        addSemanticError(state, variableDefinition->line, "`%s` already exists", variableDefinition->identifier);
+}
+
+// Checks the type and initializer of a definition. The variable is declared
+// afterwards (if "declare"), so its initializer can not refer to it.
+static void analyzeVariableDefinition(CompilerState *state, VariableDefinition *variableDefinition, boolean declare) {
+    analyzeDataType(state, variableDefinition->dataType);
+    switch (variableDefinition->type) {
+        case VARIABLE_DEFINITION_INIT_EXPRESSION:
+            analyzeExpression(state, variableDefinition->expression);
+            break;
+        case VARIABLE_DEFINITION_INIT_FUNCTION_CALL:
+            analyzeFunctionCall(state, variableDefinition->functionCall);
+            break;
+        default:
+            break;
+    }
+
+    if (declare)
+        declareVariableDefinition(state, variableDefinition);
+
+    if (variableDefinition->type == VARIABLE_DEFINITION_INIT_EXPRESSION && typeVariableDefinition(variableDefinition) == -1)
+        addSemanticError(state, variableDefinition->line, "Invalid variable definition");
+}
+
+static void analyzeParameters(CompilerState *state, ParameterDefinition *parameterDefinition) {
+    if (parameterDefinition->type == PARAMETERS_DEFINITION_NO_PARAMS) return;
+
+    Parameters *parameters = parameterDefinition->parameters;
+    for (int i = 0; i < parameters->count; ++i) {
+        Parameter *parameter = &parameters->parameters[i];
+        analyzeDataType(state, parameter->dataType);
+        if (declareVariable(state, parameter->identifier, parameter->dataType) == NULL)
+            addSemanticError(state, parameter->line, "Duplicate parameter `%s`", parameter->identifier);
+    }
+}
+
+static void analyzeEmitEvent(CompilerState *state, FunctionInstruction *instruction) {
+    analyzeArguments(state, instruction->eventArgs);
+
+    SymbolTableEntry *event = lookupSymbol(state, instruction->eventIdentifier);
+    if (event == NULL)
+        addSemanticError(state, instruction->line, "Error: undefined event `%s`", instruction->eventIdentifier);
+    if (event == NULL || event->symbolType != SYMBOL_TYPE_EVENT)
+        addSemanticError(state, instruction->line, "%s is not an event", instruction->eventIdentifier);
+}
+
+static void analyzeConditional(CompilerState *state, Conditional *conditional) {
+    analyzeExpression(state, conditional->condition);
+    if (typeExpression(conditional->condition) != DATA_TYPE_BOOLEAN)
+        addSemanticError(state, conditional->line, "Condition must be a boolean");
+
+    analyzeBlock(state, conditional->ifBlock);
+    if (conditional->type == CONDITIONAL_WITH_ELSE)
+        analyzeBlock(state, conditional->elseBlock);
+}
+
+// The variables of the initialization are only visible in the loop.
+static void analyzeLoop(CompilerState *state, Loop *loop) {
+    pushScope(state);
+
+    LoopInitialization *initialization = loop->loopInitialization;
+    switch (initialization->type) {
+        case LOOP_INITIALIZATION_VARIABLE_DEFINITION:
+            if (initialization->variable != NULL)
+                analyzeVariableDefinition(state, initialization->variable, true);
+            break;
+        case LOOP_INITIALIZATION_ASSIGNMENT:
+            analyzeAssignment(state, initialization->assignment);
+            break;
+        case LOOP_INITIALIZATION_MATH_ASSIGNMENT:
+            analyzeMathAssignment(state, initialization->mathAssignment);
+            break;
+        default:
+            break;
+    }
+
+    analyzeExpression(state, loop->loopCondition->condition);
+
+    LoopIteration *iteration = loop->loopIteration;
+    if (iteration->type == LOOP_ITERATION_MATH_ASSIGNMENT)
+        analyzeMathAssignment(state, iteration->mathAssignment);
+    else
+        analyzeAssignment(state, iteration->assignment);
+
+    analyzeBlock(state, loop->functionBlock);
+    popScope(state);
+}
+
+static void analyzeInstruction(CompilerState *state, FunctionInstruction *instruction) {
+    switch (instruction->type) {
+        case FUNCTION_INSTRUCTION_VARIABLE_DEFINITION:
+            analyzeVariableDefinition(state, instruction->variableDefinition, true);
+            break;
+        case FUNCTION_INSTRUCTION_CONDITIONAL:
+            analyzeConditional(state, instruction->conditional);
+            break;
+        case FUNCTION_INSTRUCTION_FUNCTION_CALL:
+            analyzeFunctionCall(state, instruction->functionCall);
+            break;
+        case FUNCTION_INSTRUCTION_MEMBER_CALL:
+            analyzeMemberCall(state, instruction->memberCall);
+            break;
+        case FUNCTION_INSTRUCTION_EMIT_EVENT:
+            analyzeEmitEvent(state, instruction);
+            break;
+        case FUNCTION_INSTRUCTION_ASSIGNMENT:
+            analyzeAssignment(state, instruction->assignment);
+            break;
+        case FUNCTION_INSTRUCTION_MATH_ASSIGNMENT:
+            analyzeMathAssignment(state, instruction->mathAssignment);
+            break;
+        case FUNCTION_INSTRUCTION_LOOP:
+            analyzeLoop(state, instruction->loop);
+            break;
+        default:
+            break;
+    }
+}
+
+static void analyzeInstructions(CompilerState *state, FunctionInstructions *instructions) {
+    for (int i = 0; i < instructions->count; ++i)
+        analyzeInstruction(state, instructions->instructions[i]);
+}
+
+static void analyzeBlock(CompilerState *state, FunctionBlock *block) {
+    pushScope(state);
+    analyzeInstructions(state, block->instructions);
+    popScope(state);
+}
+
+// The body of a function shares the scope of its parameters.
+static void analyzeFunction(CompilerState *state, FunctionDefinition *function) {
+    pushScope(state);
+    analyzeParameters(state, function->parameterDefinition);
+    analyzeInstructions(state, function->functionBlock->instructions);
+    popScope(state);
+}
+
+// Declares a member of the contract. The parameters of an event are only visible in its declaration.
+static void declareContractInstruction(CompilerState *state, ContractInstruction *instruction) {
+    switch (instruction->type) {
+        case STATE_VARIABLE_DECLARATION:
+            declareVariableDefinition(state, instruction->variableDefinition);
+            break;
+        case FUNCTION_DECLARATION: {
+            FunctionDefinition *function = instruction->functionDefinition;
+            if (findBuiltIn(function->identifier) != NULL)
+                addSemanticError(state, function->line, "Cannot redeclare built-in function `%s`", function->identifier);
+            // TODO: add support for function return types
+            else if (declareSymbol(state, function->identifier, DATA_TYPE_VOID, SYMBOL_TYPE_FUNCTION) == NULL)
+                addSemanticError(state, function->line, "`%s` already exists", function->identifier);
+            break;
+        }
+        case EVENT_DECLARATION:
+            pushScope(state);
+            analyzeParameters(state, instruction->eventParams);
+            popScope(state);
+            if (declareSymbol(state, instruction->eventIdentifier, DATA_TYPE_VOID, SYMBOL_TYPE_EVENT) == NULL)
+                addSemanticError(state, instruction->line, "`%s` already exists", instruction->eventIdentifier);
+            break;
+        default:
+            break;
+    }
+}
+
+static void analyzeContractInstruction(CompilerState *state, ContractInstruction *instruction) {
+    switch (instruction->type) {
+        case STATE_VARIABLE_DECLARATION:
+            analyzeVariableDefinition(state, instruction->variableDefinition, false);
+            break;
+        case FUNCTION_DECLARATION:
+            analyzeFunction(state, instruction->functionDefinition);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Once the members of the contract are declared, each one can be analyzed on
+ * its own. Every worker thread gets a copy of the compilation state with its
+ * own symbol table (a copy of the contract scope), arena, errors and counters.
+ * The errors of each member are then merged in the order of the program, so
+ * the diagnostics are the same as in a single thread.
+ */
+
+typedef struct {
+    CompilerState state;
+    CompilationStatistics statistics;
+} AnalysisWorker;
+
+// Errors found while analyzing a member of the contract, within the errors of its worker.
+typedef struct {
+    int worker;
+    int start;
+    int end;
+} MemberErrors;
+
+typedef struct {
+    ContractInstructions *instructions;
+    AnalysisWorker *workers;
+    MemberErrors *errors;
+} ParallelAnalysis;
+
+static void analyzeMembers(void *context, int start, int end, int worker) {
+    ParallelAnalysis *analysis = context;
+    CompilerState *state = &analysis->workers[worker].state;
+
+    for (int i = start; i < end; ++i) {
+        MemberErrors *errors = &analysis->errors[i];
+        errors->worker = worker;
+        errors->start = state->errorCount;
+        analyzeContractInstruction(state, analysis->instructions->instructions[i]);
+        errors->end = state->errorCount;
+    }
+}
+
+static void analyzeMembersInParallel(CompilerState *state, ContractInstructions *instructions, int jobs) {
+    AnalysisWorker *workers = calloc(jobs, sizeof(AnalysisWorker));
+    ParallelAnalysis analysis = { instructions, workers, calloc(instructions->count, sizeof(MemberErrors)) };
+
+    state->workerArenas = malloc(jobs * sizeof(Arena *));
+    state->workerArenaCount = jobs;
+    for (int i = 0; i < jobs; ++i) {
+        CompilerState *worker = &workers[i].state;
+        *worker = *state;
+        worker->errorCount = 0;
+        worker->arena = state->workerArenas[i] = createArena();
+        worker->statistics = state->statistics == NULL ? NULL : &workers[i].statistics;
+        copySymbolTable(worker, state);
+    }
+
+    parallelFor(instructions->count, jobs, analyzeMembers, &analysis);
+
+    for (int i = 0; i < instructions->count; ++i) {
+        const MemberErrors *errors = &analysis.errors[i];
+        Diagnostic *workerErrors = workers[errors->worker].state.errors;
+        for (int j = errors->start; j < errors->end; ++j) {
+            if (state->errorCount < MAX_ERRORS) state->errors[state->errorCount++] = workerErrors[j];
+            else free(workerErrors[j].message);
+        }
+    }
+
+    for (int i = 0; i < jobs; ++i) {
+        CompilerState *worker = &workers[i].state;
+        for (int library = 0; library < MAX_IMPORTS; ++library)
+            state->libraries[library] |= worker->libraries[library];
+        if (state->statistics != NULL) {
+            state->statistics->symbolLookups += workers[i].statistics.symbolLookups;
+            state->statistics->builtInGas += workers[i].statistics.builtInGas;
+        }
+        freeSymbolTable(worker);
+    }
+
+    free(analysis.errors);
+    free(workers);
+}
+
+boolean AnalyzeProgram(CompilerState *state) {
+    ContractInstructions *instructions = state->program->contract->block->instructions;
+    const int previousErrors = state->errorCount;
+
+    // The contract is the outermost scope: its members are visible from every function
+    for (int i = 0; i < instructions->count; ++i)
+        declareContractInstruction(state, instructions->instructions[i]);
+
+    int functions = 0;
+    for (int i = 0; i < instructions->count; ++i)
+        if (instructions->instructions[i]->type == FUNCTION_DECLARATION) ++functions;
+
+    if (state->options->jobs > 1 && functions > 1)
+        analyzeMembersInParallel(state, instructions, state->options->jobs < functions ? state->options->jobs : functions);
+    else {
+        for (int i = 0; i < instructions->count; ++i)
+            analyzeContractInstruction(state, instructions->instructions[i]);
+    }
+
+    sortErrorsByLine(state);
+    return state->errorCount == previousErrors;
+}
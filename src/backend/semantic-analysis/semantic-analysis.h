@@ -0,0 +1,24 @@
+#ifndef SEMANTIC_ANALYSIS_HEADER
+#define SEMANTIC_ANALYSIS_HEADER
+
+#include "../support/shared.h"
+
+/**
+ * The semantic analysis runs once the parser has built the whole AST, in a
+ * single pass over the contract: it first declares every state variable,
+ * function and event (so a function may call another one declared later), and
+ * then checks each initializer and function body, resolving its symbols and
+ * inferring the type of its expressions.
+ *
+ * The errors are reported with the line of the node where they were found, in
+ * the order of the program. With several "jobs" (see "CompilerOptions"), the
+ * members of the contract are checked by a pool of threads, with the same result.
+ */
+
+// Analyzes the program in "state". Returns false if it found semantic errors.
+boolean AnalyzeProgram(CompilerState *state);
+
+// Registra un error semántico, en la línea del nodo que lo produjo.
+void addSemanticError(CompilerState *state, int line, const char *format, ...);
+
+#endif
@@ -1,70 +1,134 @@
 #include <stdlib.h>
+#include <string.h>
 #include "./symbol-table.h"
 
-boolean symbolExists(char *identifier) {
-    boolean res = false;
-    SymbolTableEntry *symbol;
+/**
+ * Identifiers are interned by the scanner, so the table is keyed by the
+ * identifier pointer itself and reuses the hash computed at interning time.
+ * Slots are probed linearly, and hold the key, its hash and the visible
+ * symbol, so a lookup usually touches a single cache line.
+ *
+ * A name keeps its slot for the whole compilation (slots are never removed).
+ * A symbol that shadows another one takes its place in the slot and keeps a
+ * pointer to it, so closing a scope restores every hidden symbol: each
+ * declaration is pushed and popped exactly once.
+ */
 
-    HASH_FIND_STR(state.symbolTable, identifier, symbol);
+#define SYMBOL_TABLE_INITIAL_CAPACITY 256
+#define SCOPE_STACK_INITIAL_CAPACITY 64
 
-    if (symbol != NULL) res = true;
-
-    return res;
+static void *growStack(void *items, int *capacity, size_t itemSize) {
+    const int newCapacity = *capacity == 0 ? SCOPE_STACK_INITIAL_CAPACITY : 2 * *capacity;
+    items = realloc(items, newCapacity * itemSize);
+    if (items == NULL) abort();
+    *capacity = newCapacity;
+    return items;
 }
 
-void insertSymbol(char *identifier, DataTypeType type, SymbolType symbolType) {
-    SymbolTableEntry *symbol;
-
-    if (!symbolExists(identifier)) {
-        symbol = malloc(sizeof(SymbolTableEntry));
-        symbol->identifier = identifier;
-        symbol->type = type;
-        symbol->symbolType = symbolType;
-        HASH_ADD_STR(state.symbolTable, identifier, symbol);
-        
-		if (type == DATA_TYPE_ERC20) state.libraries[LIBRARY_ERC20] = true;
-		if (type == DATA_TYPE_ERC721) state.libraries[LIBRARY_ERC721] = true;
+static void growSymbolTable(SymbolTable *table) {
+    const uint32_t capacity = table->capacity == 0 ? SYMBOL_TABLE_INITIAL_CAPACITY : 2 * table->capacity;
+    SymbolSlot *slots = calloc(capacity, sizeof(SymbolSlot));
+    if (slots == NULL) abort();
+
+    for (uint32_t i = 0; i < table->capacity; ++i) {
+        if (table->slots[i].identifier == NULL) continue;
+        uint32_t slot = table->slots[i].hash & (capacity - 1);
+        while (slots[slot].identifier != NULL) slot = (slot + 1) & (capacity - 1);
+        slots[slot] = table->slots[i];
     }
+
+    free(table->slots);
+    table->slots = slots;
+    table->capacity = capacity;
 }
 
-void removeSymbol(char *identifier) {
-    SymbolTableEntry *symbol;
+// The slot of "identifier", or the free slot where it would go (NULL if the table is empty).
+static SymbolSlot *findSlot(CompilerState *state, char *identifier) {
+    SymbolTable *table = &state->symbolTable;
+    if (table->capacity == 0) return NULL;
 
-    HASH_FIND_STR(state.symbolTable, identifier, symbol);
+    uint32_t slot = internedStringHash(identifier) & (table->capacity - 1);
+    while (table->slots[slot].identifier != NULL && table->slots[slot].identifier != identifier)
+        slot = (slot + 1) & (table->capacity - 1);
+    return &table->slots[slot];
+}
 
-    if (symbol != NULL) {
-        HASH_DEL(state.symbolTable, symbol);
-        free(symbol);
-    }
+void pushScope(CompilerState *state) {
+    ScopeStack *scopes = &state->scopes;
+    if (scopes->depth == scopes->depthCapacity)
+        scopes->starts = growStack(scopes->starts, &scopes->depthCapacity, sizeof(int));
+    scopes->starts[scopes->depth++] = scopes->count;
 }
 
-void freeSymbolTable() {
-    SymbolTableEntry *symbol, *tmp;
+void popScope(CompilerState *state) {
+    ScopeStack *scopes = &state->scopes;
+    if (scopes->depth == 0) return;
 
-    HASH_ITER(hh, state.symbolTable, symbol, tmp) {
-        HASH_DEL(state.symbolTable, symbol);
-        free(symbol);
+    const int start = scopes->starts[--scopes->depth];
+    for (int i = scopes->count - 1; i >= start; --i) {
+        SymbolTableEntry *symbol = scopes->symbols[i];
+        findSlot(state, symbol->identifier)->symbol = symbol->shadowed;
     }
+    scopes->count = start;
+}
+
+SymbolTableEntry *lookupSymbol(CompilerState *state, char *identifier) {
+    if (state->statistics != NULL) ++state->statistics->symbolLookups;
+    SymbolSlot *slot = findSlot(state, identifier);
+    return slot == NULL ? NULL : slot->symbol;
 }
 
-DataTypeType getSymbolDataType(char *identifier) {
-    SymbolTableEntry *symbol;
-    HASH_FIND_STR(state.symbolTable, identifier, symbol);
-    if (symbol != NULL) {
-        return symbol->type;
+SymbolTableEntry *declareSymbol(CompilerState *state, char *identifier, DataTypeType type, SymbolType symbolType) {
+    SymbolTable *table = &state->symbolTable;
+    ScopeStack *scopes = &state->scopes;
+
+    // Keep the load factor under 1/2
+    if (2 * (table->count + 1) > table->capacity) growSymbolTable(table);
+    if (state->statistics != NULL) ++state->statistics->symbolLookups;
+
+    SymbolSlot *slot = findSlot(state, identifier);
+    if (slot->identifier == NULL) {
+        slot->identifier = identifier;
+        slot->hash = internedStringHash(identifier);
+        table->count++;
     }
-    else {
-        return -1;
+    else if (slot->symbol != NULL && slot->symbol->depth == scopes->depth) {
+        return NULL;
     }
+
+    SymbolTableEntry *symbol = arenaAllocate(state->arena, sizeof(SymbolTableEntry));
+    symbol->identifier = identifier;
+    symbol->type = type;
+    symbol->symbolType = symbolType;
+    symbol->depth = scopes->depth;
+    symbol->shadowed = slot->symbol;
+    slot->symbol = symbol;
+
+    if (scopes->count == scopes->capacity)
+        scopes->symbols = growStack(scopes->symbols, &scopes->capacity, sizeof(SymbolTableEntry *));
+    scopes->symbols[scopes->count++] = symbol;
+
+    if (type == DATA_TYPE_ERC20) state->libraries[LIBRARY_ERC20] = true;
+    if (type == DATA_TYPE_ERC721) state->libraries[LIBRARY_ERC721] = true;
+    return symbol;
 }
 
-SymbolType getSymbolType(char *identifier) {
-    SymbolTableEntry *symbol;
-    HASH_FIND_STR(state.symbolTable, identifier, symbol);
-    if (symbol != NULL) {
-        return symbol->symbolType;
-    }
-    else {
-        return -1;
+void copySymbolTable(CompilerState *target, const CompilerState *source) {
+    SymbolTable *table = &target->symbolTable;
+    *table = source->symbolTable;
+    if (table->capacity > 0) {
+        table->slots = malloc(table->capacity * sizeof(SymbolSlot));
+        if (table->slots == NULL) abort();
+        memcpy(table->slots, source->symbolTable.slots, table->capacity * sizeof(SymbolSlot));
     }
+    memset(&target->scopes, 0, sizeof(ScopeStack));
+}
+
+void freeSymbolTable(CompilerState *state) {
+    // The symbols themselves are released with the arena
+    free(state->symbolTable.slots);
+    free(state->scopes.symbols);
+    free(state->scopes.starts);
+    memset(&state->symbolTable, 0, sizeof(SymbolTable));
+    memset(&state->scopes, 0, sizeof(ScopeStack));
 }
@@ -4,16 +4,31 @@
 #include "abstract-syntax-tree.h"
 #include "../support/shared.h"
 
-boolean symbolExists(char *identifier);
+/**
+ * The contract is the outermost scope. Functions, events, blocks and loops
+ * open a nested scope, where a declaration may hide (shadow) a symbol with the
+ * same name of an enclosing scope until the scope is closed.
+ *
+ * A lookup returns the symbol itself (a handle that stays valid for the whole
+ * compilation), so callers read its type and kind without searching again.
+ */
 
-void insertSymbol(char *identifier, DataTypeType type, SymbolType symbolType);
+void pushScope(CompilerState *state);
 
-void removeSymbol(char *identifier);
+// Closes the innermost scope: its symbols are dropped and the ones they hid are visible again.
+void popScope(CompilerState *state);
 
-void freeSymbolTable();
+// The symbol of "identifier" visible from the current scope, or NULL.
+SymbolTableEntry *lookupSymbol(CompilerState *state, char *identifier);
 
-DataTypeType getSymbolDataType(char *identifier);
+// Declares "identifier" in the current scope. Returns NULL if it is already declared there.
+SymbolTableEntry *declareSymbol(CompilerState *state, char *identifier, DataTypeType type, SymbolType symbolType);
 
-SymbolType getSymbolType(char *identifier);
+// Gives "target" its own copy of the symbols of "source", which must be in the
+// outermost scope (i.e., the members of the contract), so that it can open and
+// close scopes without affecting "source". The symbols themselves are shared.
+void copySymbolTable(CompilerState *target, const CompilerState *source);
+
+void freeSymbolTable(CompilerState *state);
 
 #endif
@@ -1,22 +1,38 @@
 #include <string.h>
 #include "type-checking.h"
 #include "../domain-specific/builtins.h"
+#include "../support/uint256.h"
 
-int typeAssignment(Assignment *assignment) {
-    int assignable = typeAssignable(assignment->assignable);
-    int expression = typeExpression(assignment->expression);
+// The constant of "expression" if it is a literal (e.g., `5` or `"text"`), or NULL.
+static Constant *literalOf(Expression *expression) {
+    if (expression->type != EXPRESSION_FACTOR || expression->factor->type != FACTOR_CONSTANT)
+        return NULL;
+    return expression->factor->constant;
+}
+
+// Whether "literal" is a number that fits in an "int" (e.g., a "uint" literal below 2^255).
+static boolean fitsInInt(Constant *literal) {
+    if (literal == NULL || (literal->type != CONSTANT_INTEGER && literal->type != CONSTANT_SCIENTIFIC_NOTATION))
+        return false;
+    return literal->number != NULL && uint256FitsInt(&literal->number->magnitude, literal->number->negative);
+}
+
+int typeAssignment(CompilerState *state, Assignment *assignment) {
+    int assignable = typeAssignable(state, assignment->assignable);
 
-    Factor *factor = assignment->expression->factor;
     switch (assignment->type) {
-        case ASSIGNMENT_EXPRESSION:
-            if (assignable == expression || (assignable == DATA_TYPE_BYTES && assignment->expression->factor != NULL && assignment->expression->factor->constant != NULL && assignment->expression->factor->constant->type == CONSTANT_STRING)
-                                        || (assignable == DATA_TYPE_INT && assignment->expression->factor != NULL && assignment->expression->factor->constant != NULL && assignment->expression->factor->constant->type == CONSTANT_INTEGER)) {
+        case ASSIGNMENT_EXPRESSION: {
+            int expression = typeExpression(assignment->expression);
+            Constant *literal = literalOf(assignment->expression);
+            if (assignable == expression || (assignable == DATA_TYPE_BYTES && literal != NULL && literal->type == CONSTANT_STRING)
+                                        || (assignable == DATA_TYPE_INT && fitsInInt(literal))) {
                 return assignable;
             } else {
                 return -1;
             }
+        }
         case ASSIGNMENT_FUNCTION_CALL:
-            if (isBuiltInFunction(assignment->functionCall->identifier))
+            if (assignment->functionCall->builtIn != NULL)
                 return DATA_TYPE_VOID;
             else
                 return -1;
@@ -25,10 +41,10 @@ int typeAssignment(Assignment *assignment) {
     }
 }
 
-int typeMathAssignment(MathAssignment *mathAssignment) {
+int typeMathAssignment(CompilerState *state, MathAssignment *mathAssignment) {
     switch(mathAssignment->type) {
         case MATH_ASSIGNMENT_OPERATOR:
-            switch (typeAssignable(mathAssignment->variable)) {
+            switch (typeAssignable(state, mathAssignment->variable)) {
                 case DATA_TYPE_INT:
                     break;
                 case DATA_TYPE_UINT:
@@ -46,7 +62,7 @@ int typeMathAssignment(MathAssignment *mathAssignment) {
             }
         case MATH_ASSIGNMENT_INCREMENT:
         case MATH_ASSIGNMENT_DECREMENT:
-            switch (typeAssignable(mathAssignment->variable)) {
+            switch (typeAssignable(state, mathAssignment->variable)) {
                 case DATA_TYPE_INT:
                     return DATA_TYPE_INT;
                 case DATA_TYPE_UINT:
@@ -59,32 +75,24 @@ int typeMathAssignment(MathAssignment *mathAssignment) {
     }
 }
 
-int typeFunctionCall(FunctionCall *functionCall) {
+int typeFunctionCall(CompilerState *state, FunctionCall *functionCall) {
+    if (functionCall->builtIn != NULL)
+        return functionCall->builtIn->returnType;
+
     switch(functionCall->type) {
         case FUNCTION_CALL_NO_ARGS:
         case FUNCTION_CALL_WITH_ARGS:
-            if (isBuiltInFunction(functionCall->identifier))
+            if (functionCall->symbol != NULL && functionCall->symbol->symbolType == SYMBOL_TYPE_FUNCTION)
                 return DATA_TYPE_VOID;
-
-            switch (getSymbolType(functionCall->identifier)) {
-                case SYMBOL_TYPE_FUNCTION:
-                    return DATA_TYPE_VOID;
-                default:
-                    return -1;
-            }
-	    case BUILT_IN_TRANSFER_ETH:
-	    case BUILT_IN_BALANCE:
-	    case BUILT_IN_LOG:
-            return DATA_TYPE_VOID;
-	    case BUILT_IN_CREATE_PROXY_TO:
-            return DATA_TYPE_ADDRESS;
+            else
+                return -1;
         default:
             return -1;
     }
 }
 
-int typeMemberCall(MemberCall *memberCall) {
-    int assignable = typeAssignable(memberCall->instance);
+int typeMemberCall(CompilerState *state, MemberCall *memberCall) {
+    int assignable = typeAssignable(state, memberCall->instance);
 
     switch(assignable) {
         case DATA_TYPE_ERC20:
@@ -108,8 +116,8 @@ int typeVariableDefinition(VariableDefinition *variableDefinition) {
     if (variableDefinition->dataType->type == expression)
         return variableDefinition->dataType->type;
 
-    Factor *factor = variableDefinition->expression->factor;
-    
+    Constant *literal = literalOf(variableDefinition->expression);
+
     switch (variableDefinition->dataType->type) {
         case DATA_TYPE_ERC20:
         case DATA_TYPE_ERC721:
@@ -118,18 +126,39 @@ int typeVariableDefinition(VariableDefinition *variableDefinition) {
             else 
                 return -1;
         case DATA_TYPE_BYTES:
-            if (factor != NULL && factor->constant != NULL && factor->constant->type == CONSTANT_STRING)
+            if (literal != NULL && literal->type == CONSTANT_STRING)
                 return variableDefinition->dataType->type;
         case DATA_TYPE_INT:
-            if (factor != NULL && factor->constant != NULL && factor->constant->type == CONSTANT_INTEGER)
+            if (fitsInInt(literal))
                 return variableDefinition->dataType->type;
         default:
             return -1;
     }
 }
 
+/**
+ * The type of every Expression, Factor and Constant is inferred once, by the
+ * semantic analysis (which visits the children first), from the types already
+ * cached on its children. typeExpression, typeFactor and typeConstant just read
+ * that cache, so enclosing checks never walk a subtree again.
+ */
+
 int typeExpression(Expression *expression) {
     if (expression == NULL) return 0;
+    return expression->inferredType;
+}
+
+int typeFactor(Factor *factor) {
+    return factor->inferredType;
+}
+
+int typeConstant(Constant *constant) {
+    return constant->inferredType;
+}
+
+int inferExpressionType(Expression *expression) {
+    if (expression->type == EXPRESSION_FACTOR)
+        return typeFactor(expression->factor);
 
     int leftType = typeExpression(expression->left);
     int rightType = typeExpression(expression->right);
@@ -181,20 +210,18 @@ int typeExpression(Expression *expression) {
                 return -1;
             }
         case EXPRESSION_NOT:
-            if (typeExpression(expression->right) == DATA_TYPE_BOOLEAN) {
+            if (rightType == DATA_TYPE_BOOLEAN) {
                 return DATA_TYPE_BOOLEAN;
             }
             else {
                 return -1;
             }
-        case EXPRESSION_FACTOR:
-            return typeFactor(expression->factor);
         default:
             return -1;
     }
 }
 
-int typeFactor(Factor *factor) {
+int inferFactorType(Factor *factor) {
     switch (factor->type) {
         case FACTOR_EXPRESSION:
             return typeExpression(factor->expression);
@@ -205,53 +232,52 @@ int typeFactor(Factor *factor) {
     }
 }
 
-
-int typeConstant(Constant *constant) {
+int inferConstantType(CompilerState *state, Constant *constant) {
     switch (constant->type) {
         case CONSTANT_INTEGER:
-            return typeInteger(constant->value);
+        case CONSTANT_SCIENTIFIC_NOTATION:
+        case CONSTANT_FOLDED:
+            return typeNumber(constant->number);
         case CONSTANT_BOOLEAN:
             return DATA_TYPE_BOOLEAN;
         case CONSTANT_STRING:
             return DATA_TYPE_STRING;
         case CONSTANT_ADDRESS:
             return DATA_TYPE_ADDRESS;
-        case CONSTANT_SCIENTIFIC_NOTATION:
-            if (constant->string[0] == '-')
-                return DATA_TYPE_INT;
-            else
-                return DATA_TYPE_UINT;
         case CONSTANT_VARIABLE:
-            return typeAssignable(constant->variable);
+            return typeAssignable(state, constant->variable);
         default:
             return -1;
     }
 }
 
-int typeAssignable(Assignable *assignable) {
+int typeAssignable(CompilerState *state, Assignable *assignable) {
     int typeArrayIndex = typeExpression(assignable->arrayIndex);
     switch (assignable->type) {
         case ASSIGNABLE_VARIABLE:
-            return typeVariable(assignable->identifier);
+            return typeVariable(assignable->symbol);
         case ASSIGNABLE_ARRAY:
             if (typeArrayIndex == -1 || typeArrayIndex != DATA_TYPE_UINT)
                 return -1;
 
-            if (getSymbolType(assignable->identifier) != SYMBOL_TYPE_ARRAY)
+            if (assignable->symbol == NULL || assignable->symbol->symbolType != SYMBOL_TYPE_ARRAY)
                 return -1;
-            return getSymbolDataType(assignable->identifier);
+            return assignable->symbol->type;
         default:
             return -1;
     }
 }
 
-int typeVariable(char *identifier) {
-    return getSymbolDataType(identifier);
+// The symbol was resolved by the semantic analysis (NULL if it does not exist).
+int typeVariable(SymbolTableEntry *symbol) {
+    return symbol == NULL ? -1 : (int) symbol->type;
 }
 
-// check if it is string (scientificc notation), uint or int
-int typeInteger(int value) {
-   if (value < 0) {
+// A negative literal is an "int", any other a "uint" (-1 if it is not an integer of 256 bits).
+int typeNumber(Number *number) {
+   if (number == NULL) {
+       return -1;
+   } else if (number->negative) {
        return DATA_TYPE_INT;
    } else {
        return DATA_TYPE_UINT;
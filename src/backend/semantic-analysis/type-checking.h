@@ -5,16 +5,19 @@
 #include "../support/shared.h"
 #include "./symbol-table.h"
 
-int typeAssignment(Assignment *assignment);
-int typeMathAssignment(MathAssignment *mathAssignment);
-int typeFunctionCall(FunctionCall *functionCall);
-int typeMemberCall(MemberCall *memberCall);
+int typeAssignment(CompilerState *state, Assignment *assignment);
+int typeMathAssignment(CompilerState *state, MathAssignment *mathAssignment);
+int typeFunctionCall(CompilerState *state, FunctionCall *functionCall);
+int typeMemberCall(CompilerState *state, MemberCall *memberCall);
 int typeVariableDefinition(VariableDefinition *variableDefinition);
 int typeExpression(Expression * expression);
 int typeFactor(Factor * factor);
 int typeConstant(Constant * constant);
-int typeAssignable(Assignable * assignable);
-int typeVariable(char * identifier);
-int typeInteger(int value);
+int inferExpressionType(Expression * expression);
+int inferFactorType(Factor * factor);
+int inferConstantType(CompilerState *state, Constant * constant);
+int typeAssignable(CompilerState *state, Assignable * assignable);
+int typeVariable(SymbolTableEntry * symbol);
+int typeNumber(Number *number);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+/**
+ * Implementación de "arena.h".
+ */
+
+#define ARENA_CHUNK_SIZE (64 * 1024)
+#define ARENA_ALIGNMENT 16
+#define ARENA_SLAB_SIZE 2048
+
+struct ArenaChunk {
+	ArenaChunk *next;
+	size_t size;
+	size_t offset;
+	char *data;
+};
+
+static ArenaChunk *createChunk(Arena *arena, size_t minimumSize) {
+	// Reuse a chunk kept by resetArena, if it is large enough
+	if (arena->spareChunks != NULL && minimumSize <= ARENA_CHUNK_SIZE) {
+		ArenaChunk *chunk = arena->spareChunks;
+		arena->spareChunks = chunk->next;
+		chunk->offset = 0;
+		chunk->next = arena->chunks;
+		arena->chunks = chunk;
+		return chunk;
+	}
+
+	size_t size = minimumSize > ARENA_CHUNK_SIZE ? minimumSize : ARENA_CHUNK_SIZE;
+
+	// The header and the data share a single system allocation
+	size_t headerSize = (sizeof(ArenaChunk) + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+	ArenaChunk *chunk = malloc(headerSize + size);
+	if (chunk == NULL) return NULL;
+
+	chunk->size = size;
+	chunk->offset = 0;
+	chunk->data = (char *) chunk + headerSize;
+	chunk->next = arena->chunks;
+	arena->chunks = chunk;
+	arena->bytesReserved += headerSize + size;
+	return chunk;
+}
+
+Arena *createArena() {
+	Arena *arena = calloc(1, sizeof(Arena));
+	if (arena == NULL) return NULL;
+	createChunk(arena, ARENA_CHUNK_SIZE);
+	return arena;
+}
+
+void *arenaAllocate(Arena *arena, size_t size) {
+	size_t alignedSize = (size + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+	ArenaChunk *chunk = arena->chunks;
+
+	if (chunk == NULL || chunk->size - chunk->offset < alignedSize) {
+		chunk = createChunk(arena, alignedSize);
+		if (chunk == NULL) return NULL;
+	}
+
+	void *block = chunk->data + chunk->offset;
+	chunk->offset += alignedSize;
+	arena->bytesUsed += size;
+
+	memset(block, 0, size);
+	return block;
+}
+
+char *arenaStrndup(Arena *arena, const char *string, size_t length) {
+	char *copy = arenaAllocate(arena, length + 1);
+	if (copy == NULL) return NULL;
+	memcpy(copy, string, length);
+	copy[length] = '\0';
+	return copy;
+}
+
+void *arenaGrow(Arena *arena, void *block, size_t size, size_t newSize) {
+	size_t alignedSize = (size + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+	size_t alignedNewSize = (newSize + ARENA_ALIGNMENT - 1) & ~(size_t) (ARENA_ALIGNMENT - 1);
+	ArenaChunk *chunk = arena->chunks;
+
+	if (block != NULL && chunk != NULL && (char *) block + alignedSize == chunk->data + chunk->offset
+			&& chunk->size - chunk->offset >= alignedNewSize - alignedSize) {
+		chunk->offset += alignedNewSize - alignedSize;
+		arena->bytesUsed += newSize - size;
+		memset((char *) block + size, 0, newSize - size);
+		return block;
+	}
+
+	void *grown = arenaAllocate(arena, newSize);
+	if (grown != NULL && block != NULL) memcpy(grown, block, size);
+	return grown;
+}
+
+void *arenaSlabAllocate(Arena *arena, ArenaSlab *slab, size_t itemSize) {
+	if (slab->remaining < itemSize) {
+		const size_t size = itemSize > ARENA_SLAB_SIZE ? itemSize : ARENA_SLAB_SIZE - ARENA_SLAB_SIZE % itemSize;
+		slab->next = arenaAllocate(arena, size);
+		if (slab->next == NULL) return NULL;
+		slab->remaining = size;
+	}
+	void *item = slab->next;
+	slab->next += itemSize;
+	slab->remaining -= itemSize;
+	return item;
+}
+
+size_t arenaBytesUsed(const Arena *arena) {
+	return arena->bytesUsed;
+}
+
+static void freeChunks(ArenaChunk *chunk) {
+	while (chunk != NULL) {
+		ArenaChunk *next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+}
+
+void resetArena(Arena *arena) {
+	ArenaChunk *chunk = arena->chunks;
+	while (chunk != NULL) {
+		ArenaChunk *next = chunk->next;
+		if (chunk->size == ARENA_CHUNK_SIZE) {
+			chunk->next = arena->spareChunks;
+			arena->spareChunks = chunk;
+		}
+		else {
+			// Oversized chunks served a single large block: give them back
+			arena->bytesReserved -= (char *) chunk->data - (char *) chunk + chunk->size;
+			free(chunk);
+		}
+		chunk = next;
+	}
+	arena->chunks = NULL;
+	arena->bytesUsed = 0;
+	createChunk(arena, ARENA_CHUNK_SIZE);
+}
+
+void freeArena(Arena *arena) {
+	if (arena == NULL) return;
+	freeChunks(arena->chunks);
+	freeChunks(arena->spareChunks);
+	free(arena);
+}
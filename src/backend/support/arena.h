@@ -0,0 +1,62 @@
+#ifndef ARENA_HEADER
+#define ARENA_HEADER
+
+#include <stddef.h>
+
+/**
+ * Region allocator. Memory is bump-allocated from large chunks and released
+ * all at once when the arena is freed, so the lifetime of every block is the
+ * lifetime of the arena (e.g., the AST of a single compilation).
+ */
+
+typedef struct ArenaChunk ArenaChunk;
+
+typedef struct {
+	// Chunk currently being filled (chunks are linked newest first).
+	ArenaChunk *chunks;
+
+	// Chunks kept by resetArena, ready to be filled again.
+	ArenaChunk *spareChunks;
+
+	// Bytes handed out to callers (without alignment padding).
+	size_t bytesUsed;
+
+	// Bytes requested from the system for all chunks.
+	size_t bytesReserved;
+} Arena;
+
+// Remaining part of a block of same-sized items (see arenaSlabAllocate).
+typedef struct {
+	char *next;
+	size_t remaining;
+} ArenaSlab;
+
+Arena *createArena();
+
+// Returns a zero-initialized block, like calloc(1, size).
+void *arenaAllocate(Arena *arena, size_t size);
+
+// Copies the first "length" characters of "string" into the arena.
+char *arenaStrndup(Arena *arena, const char *string, size_t length);
+
+// Grows "block" (of "size" bytes) to "newSize" bytes, zeroing the new bytes. The
+// block is extended in place if it was the last one allocated; otherwise its
+// contents are moved to a new block (the old one is released with the arena).
+void *arenaGrow(Arena *arena, void *block, size_t size, size_t newSize);
+
+// Returns a zero-initialized item of "itemSize" bytes from "slab", which is
+// refilled from the arena with a block of several items at a time. Items taken
+// from the same slab are therefore contiguous and unpadded, i.e., they form a
+// typed array: "itemSize" must be the sizeof of their type (which is always a
+// multiple of its alignment), so that every item is aligned as in an array.
+void *arenaSlabAllocate(Arena *arena, ArenaSlab *slab, size_t itemSize);
+
+size_t arenaBytesUsed(const Arena *arena);
+
+// Releases every block at once but keeps the chunks, so a long-lived process
+// can reuse the same (already warm) memory for the next compilation.
+void resetArena(Arena *arena);
+
+void freeArena(Arena *arena);
+
+#endif
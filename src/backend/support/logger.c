@@ -8,9 +8,12 @@
  */
 
 void Log(FILE * const stream, const char * prefix, const char * const format, const char * suffix, va_list arguments) {
+	// Evita que se intercalen los mensajes de distintos hilos
+	flockfile(stream);
 	fprintf(stream, "%s", prefix);
 	vfprintf(stream, format, arguments);
 	fprintf(stream, "%s", suffix);
+	funlockfile(stream);
 }
 
 void LogDebug(const char * const format, ...) {
@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "output-buffer.h"
+
+/**
+ * Implementación de "output-buffer.h".
+ */
+
+#define OUTPUT_BUFFER_INITIAL_CAPACITY 4096
+
+// Makes room for "extra" more bytes plus the trailing NUL.
+static void reserve(OutputBuffer *buffer, size_t extra) {
+	size_t required = buffer->length + extra + 1;
+	if (required <= buffer->capacity) return;
+
+	size_t capacity = buffer->capacity == 0 ? OUTPUT_BUFFER_INITIAL_CAPACITY : buffer->capacity;
+	while (capacity < required) capacity *= 2;
+
+	char *data = realloc(buffer->data, capacity);
+	if (data == NULL) {
+		perror("Error growing output buffer");
+		exit(EXIT_FAILURE);
+	}
+	buffer->data = data;
+	buffer->capacity = capacity;
+}
+
+void initOutputBuffer(OutputBuffer *buffer) {
+	buffer->data = NULL;
+	buffer->length = 0;
+	buffer->capacity = 0;
+	reserve(buffer, 0);
+	buffer->data[0] = '\0';
+}
+
+void appendToBuffer(OutputBuffer *buffer, const char *data, size_t length) {
+	reserve(buffer, length);
+	memcpy(buffer->data + buffer->length, data, length);
+	buffer->length += length;
+	buffer->data[buffer->length] = '\0';
+}
+
+void appendFormatToBuffer(OutputBuffer *buffer, const char *format, va_list arguments) {
+	va_list copy;
+	va_copy(copy, arguments);
+	int length = vsnprintf(buffer->data + buffer->length, buffer->capacity - buffer->length, format, copy);
+	va_end(copy);
+
+	if (length < 0) return;
+
+	if ((size_t) length >= buffer->capacity - buffer->length) {
+		reserve(buffer, length);
+		vsnprintf(buffer->data + buffer->length, buffer->capacity - buffer->length, format, arguments);
+	}
+	buffer->length += length;
+}
+
+void clearOutputBuffer(OutputBuffer *buffer) {
+	buffer->length = 0;
+	if (buffer->data != NULL) buffer->data[0] = '\0';
+}
+
+void freeOutputBuffer(OutputBuffer *buffer) {
+	free(buffer->data);
+	buffer->data = NULL;
+	buffer->length = 0;
+	buffer->capacity = 0;
+}
@@ -0,0 +1,29 @@
+#ifndef OUTPUT_BUFFER_HEADER
+#define OUTPUT_BUFFER_HEADER
+
+#include <stdarg.h>
+#include <stddef.h>
+
+/**
+ * Growable, NUL-terminated byte buffer used to build the generated program in
+ * memory before writing it out with a single call.
+ */
+
+typedef struct {
+	char *data;
+	size_t length;
+	size_t capacity;
+} OutputBuffer;
+
+void initOutputBuffer(OutputBuffer *buffer);
+
+void appendToBuffer(OutputBuffer *buffer, const char *data, size_t length);
+
+void appendFormatToBuffer(OutputBuffer *buffer, const char *format, va_list arguments);
+
+// Empties the buffer, keeping its memory for the next use.
+void clearOutputBuffer(OutputBuffer *buffer);
+
+void freeOutputBuffer(OutputBuffer *buffer);
+
+#endif
@@ -2,7 +2,9 @@
 #define SHARED_HEADER
 
 #include <stdio.h>
-#include "../semantic-analysis/uthash.h"
+#include "arena.h"
+#include "statistics.h"
+#include "string-pool.h"
 
 #include "../semantic-analysis/abstract-syntax-tree.h"
 
@@ -10,30 +12,28 @@
 #define MAX_ERRORS 100
 #define MAX_IMPORTS 20
 
-// Descriptor del archivo de entrada que utiliza Bison.
-extern FILE * yyin;
-
-// Descriptor del archivo de salida que utiliza Bison.
-extern FILE * yyout;
-
-// La cantidad de caracteres en el lexema "yytext". Se debe leer en las
-// acciones de Flex, no en Bison.
-extern int yyleng;
-
-// Variable global que contiene el número de la línea analizada.
-extern int yylineno;
-
-// Token actual en el tope de la pila del analizador Bison.
-extern char * yytext;
+// Estado de un analizador léxico Flex reentrante. Cada compilación crea el
+// suyo, de modo que varias pueden ejecutarse en paralelo.
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void * yyscan_t;
+#endif
 
-// Función global de manejo de errores en Bison.
-extern void yyerror(const char * string);
+// Buffers de entrada de Flex (permiten escanear directamente desde memoria).
+#ifndef YY_TYPEDEF_YY_BUFFER_STATE
+#define YY_TYPEDEF_YY_BUFFER_STATE
+typedef struct yy_buffer_state * YY_BUFFER_STATE;
+#endif
+extern YY_BUFFER_STATE yy_scan_buffer(char * base, size_t size, yyscan_t scanner);
+extern void yy_delete_buffer(YY_BUFFER_STATE buffer, yyscan_t scanner);
 
-// Función global del analizador léxico Flex.
-extern int yylex(void);
+// El número de la línea analizada, y el lexema actual (y su largo).
+extern int yyget_lineno(yyscan_t scanner);
+extern char * yyget_text(yyscan_t scanner);
+extern int yyget_leng(yyscan_t scanner);
 
-// Función global del analizador sintáctico Bison.
-extern int yyparse(void);
+// Libera el analizador léxico.
+extern int yylex_destroy(yyscan_t scanner);
 
 // El tipo de los tokens emitidos por Flex.
 typedef int token;
@@ -50,22 +50,84 @@ typedef enum {
 	SYMBOL_TYPE_EVENT
 } SymbolType;
 
-typedef struct SymbolTableEntry {
-    char *identifier;  // hash key
-    // Add more fields here if needed
+// Un símbolo declarado. Vive en la arena, de modo que los nodos que lo usan
+// pueden guardarlo aún después de que se cierre su scope.
+struct SymbolTableEntry {
+    char *identifier;  // interned, compared by pointer
     DataTypeType type;
 	SymbolType symbolType;
-    UT_hash_handle hh; // makes this structure hashable
-} SymbolTableEntry;
+
+    // Scope where the symbol was declared (0 is the contract), and the symbol
+    // with the same name of an enclosing scope that it hides, if any.
+    int depth;
+    SymbolTableEntry *shadowed;
+};
+
+// Una posición de la tabla de símbolos: un nombre, y su símbolo visible.
+typedef struct {
+	char *identifier; // NULL si la posición está libre
+	uint32_t hash;    // el hash del string internado
+	SymbolTableEntry *symbol; // NULL si el nombre no es visible en el scope actual
+} SymbolSlot;
+
+// Tabla de direccionamiento abierto (la capacidad es una potencia de 2), con
+// una posición por cada nombre declarado alguna vez en la compilación.
+typedef struct {
+	SymbolSlot *slots;
+	uint32_t capacity;
+	uint32_t count;
+} SymbolTable;
+
+// Pila de scopes: los símbolos en el orden en que se declararon, y la posición
+// en la que empieza cada scope abierto (ver "symbol-table.h").
+typedef struct {
+	SymbolTableEntry **symbols;
+	int count;
+	int capacity;
+
+	int *starts;
+	int depth;
+	int depthCapacity;
+} ScopeStack;
 
 typedef enum {
+	LIBRARY_NONE = -1,
 	LIBRARY_ERC20,
 	LIBRARY_ERC721,
 	LIBRARY_CLONES,
 	LIBRARY_CONSOLE
 } Library;
 
-// Estado global de toda la aplicación.
+typedef enum {
+	DIAGNOSTIC_SYNTAX_ERROR,
+	DIAGNOSTIC_SEMANTIC_ERROR
+} DiagnosticType;
+
+// Un error detectado durante la compilación.
+typedef struct {
+	DiagnosticType type;
+	int line;
+	char *message;
+
+	// El lexema que produjo un error de sintaxis (NULL en errores semánticos).
+	char *lexeme;
+} Diagnostic;
+
+// Opciones de generación de código.
+typedef struct {
+	int indentationSize;
+	boolean indentUsingSpaces;
+	boolean indentOutput;
+
+	// Medir el tiempo de cada fase y contar el trabajo realizado en ella.
+	boolean collectStatistics;
+
+	// Hilos con los que se analizan y generan las funciones del contrato (el
+	// resultado es el mismo con cualquier cantidad).
+	int jobs;
+} CompilerOptions;
+
+// Estado de una compilación (una unidad de entrada).
 typedef struct {
 	// Indica si la compilación tuvo problemas hasta el momento.
 	boolean succeed;
@@ -73,22 +135,51 @@ typedef struct {
 	// El nodo raíz del AST (se usará cuando se implemente el backend).
 	Program *program;
 
-	// Agregar lo que sea necesario para el compilador.
-	// Agregar una pila para manipular scopes.
-	// Agregar una tabla de símbolos.
-	// ...
-	SymbolTableEntry *symbolTable;
+	// Región donde se alojan los nodos del AST y los lexemas, se libera de una vez.
+	Arena *arena;
+
+	// Los nodos de cada tipo se reservan de a bloques contiguos de la arena.
+	ArenaSlab nodeSlabs[NODE_TYPE_COUNT];
+
+	// Lexemas internados: un único puntero por cada string distinto.
+	StringPool *strings;
+
+	// Tabla de símbolos: para cada nombre, el símbolo visible en el scope
+	// actual. La pila permite cerrar un scope y recuperar los que ocultaba.
+	SymbolTable symbolTable;
+	ScopeStack scopes;
+
+	// Arenas de los hilos del análisis semántico, con los símbolos locales de
+	// las funciones que analizó cada uno (NULL si el análisis usó un solo hilo).
+	Arena **workerArenas;
+	int workerArenaCount;
 
 	// Agregar un array para guardar los errores.
-	char *errors[MAX_ERRORS];
+	Diagnostic errors[MAX_ERRORS];
 	int errorCount;
 
 	boolean libraries[MAX_IMPORTS];
 
-	// Agregar una pila para manipular scopes.
+	// Analizador léxico de esta compilación (para conocer la línea actual).
+	yyscan_t scanner;
+
+	// Opciones con las que se genera el código.
+	const CompilerOptions *options;
+
+	// Sesión dueña de la arena y de la tabla de strings (NULL si son propias).
+	struct CompilerSession *session;
+
+	// Estadísticas de la compilación (NULL si no se recolectan).
+	CompilationStatistics *statistics;
 } CompilerState;
 
-// El estado se define e inicializa en el archivo "main.c".
-extern CompilerState state;
+// No hay un estado global: cada compilación crea el suyo (ver "compiler.c"), y
+// Flex y Bison lo reciben como parámetro ("yyextra" y "%parse-param").
+
+// Crea un analizador léxico cuyo "yyextra" es el estado de la compilación.
+extern int yylex_init_extra(CompilerState * state, yyscan_t * scanner);
+
+// Función de manejo de errores en Bison.
+extern void yyerror(yyscan_t scanner, CompilerState * state, const char * string);
 
 #endif
@@ -0,0 +1,88 @@
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "statistics.h"
+
+/**
+ * Implementación de "statistics.h".
+ */
+
+static const char *phaseNames[PHASE_COUNT] = {
+	"parsing",
+	"semanticAnalysis",
+	"optimization",
+	"codeGeneration",
+	"cleanup"
+};
+
+static const char *nodeTypeNames[NODE_TYPE_COUNT] = {
+	"Program",
+	"ContractDefinition",
+	"ContractBlock",
+	"FunctionBlock",
+	"Conditional",
+	"ContractInstructions",
+	"ContractInstruction",
+	"FunctionInstructions",
+	"FunctionInstruction",
+	"Loop",
+	"LoopInitialization",
+	"LoopCondition",
+	"LoopIteration",
+	"Assignable",
+	"Assignment",
+	"MathAssignment",
+	"MathAssignmentOperator",
+	"FunctionCall",
+	"Arguments",
+	"MemberCall",
+	"VariableDefinition",
+	"DataType",
+	"FunctionDefinition",
+	"Decorators",
+	"ParameterDefinition",
+	"Parameters",
+	"Expression",
+	"Factor",
+	"Constant"
+};
+
+static void appendJson(OutputBuffer *json, const char *format, ...) {
+	va_list arguments;
+	va_start(arguments, format);
+	appendFormatToBuffer(json, format, arguments);
+	va_end(arguments);
+}
+
+void addStatistics(CompilationStatistics *total, const CompilationStatistics *unit) {
+	for (int i = 0; i < PHASE_COUNT; ++i) total->phaseNanoseconds[i] += unit->phaseNanoseconds[i];
+	for (int i = 0; i < NODE_TYPE_COUNT; ++i) total->nodes[i] += unit->nodes[i];
+	total->tokens += unit->tokens;
+	total->symbolLookups += unit->symbolLookups;
+	total->arenaBytes += unit->arenaBytes;
+	total->bytesWritten += unit->bytesWritten;
+	total->builtInGas += unit->builtInGas;
+	total->deadBranches += unit->deadBranches;
+	total->deadLoops += unit->deadLoops;
+	total->emptyBlocks += unit->emptyBlocks;
+	total->eliminatedInstructions += unit->eliminatedInstructions;
+}
+
+void appendStatisticsJson(const CompilationStatistics *statistics, OutputBuffer *json) {
+	appendJson(json, "{\"phases\": {");
+	for (int i = 0; i < PHASE_COUNT; ++i) {
+		appendJson(json, "%s\"%s\": %.9f", i == 0 ? "" : ", ", phaseNames[i], statistics->phaseNanoseconds[i] / 1e9);
+	}
+
+	uint64_t nodes = 0;
+	for (int i = 0; i < NODE_TYPE_COUNT; ++i) nodes += statistics->nodes[i];
+	appendJson(json, "}, \"counters\": {\"tokens\": %" PRIu64 ", \"symbolLookups\": %" PRIu64 ", \"arenaBytes\": %" PRIu64
+		", \"bytesWritten\": %" PRIu64 ", \"builtInGas\": %" PRIu64 ", \"nodes\": %" PRIu64 ", \"nodesByType\": {",
+		statistics->tokens, statistics->symbolLookups, statistics->arenaBytes, statistics->bytesWritten, statistics->builtInGas, nodes);
+	for (int i = 0; i < NODE_TYPE_COUNT; ++i) {
+		appendJson(json, "%s\"%s\": %" PRIu64, i == 0 ? "" : ", ", nodeTypeNames[i], statistics->nodes[i]);
+	}
+	appendJson(json, "}}, \"deadCode\": {\"deadBranches\": %" PRIu64 ", \"deadLoops\": %" PRIu64 ", \"emptyBlocks\": %" PRIu64
+		", \"eliminatedInstructions\": %" PRIu64 "}}",
+		statistics->deadBranches, statistics->deadLoops, statistics->emptyBlocks, statistics->eliminatedInstructions);
+}
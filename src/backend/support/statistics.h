@@ -0,0 +1,82 @@
+#ifndef STATISTICS_HEADER
+#define STATISTICS_HEADER
+
+#include <stdint.h>
+#include <time.h>
+
+#include "../semantic-analysis/abstract-syntax-tree.h"
+#include "output-buffer.h"
+
+/**
+ * Estadísticas de una compilación: el tiempo de cada fase, medido con un reloj
+ * monotónico de alta resolución, y contadores del trabajo realizado. Solo se
+ * recolectan si se piden (ver "collectStatistics" en "CompilerOptions").
+ */
+
+typedef enum {
+	PHASE_PARSING,              // escaneo y parsing (yyparse), que construye el AST
+	PHASE_SEMANTIC_ANALYSIS,    // análisis semántico, en una pasada sobre el AST completo
+	PHASE_OPTIMIZATION,         // optimizaciones sobre el AST ya analizado (p.ej., constant folding)
+	PHASE_CODE_GENERATION,      // generación de código
+	PHASE_CLEANUP,              // liberación de los recursos de la compilación
+	PHASE_COUNT
+} CompilerPhase;
+
+typedef struct {
+	uint64_t phaseNanoseconds[PHASE_COUNT];
+
+	// Tokens emitidos por Flex.
+	uint64_t tokens;
+
+	// Nodos del AST creados, por tipo.
+	uint64_t nodes[NODE_TYPE_COUNT];
+
+	// Búsquedas en la tabla de símbolos.
+	uint64_t symbolLookups;
+
+	// Bytes reservados en la arena, y bytes de código generado.
+	uint64_t arenaBytes;
+	uint64_t bytesWritten;
+
+	// Gas estimado de las llamadas a built-ins del programa (una vez cada una, sin
+	// contar ciclos): la suma de sus "gasCost" (ver "builtins.h").
+	uint64_t builtInGas;
+
+	// Código que no se genera por ser inalcanzable (ver "dead-code-elimination.h"):
+	// condicionales con una rama muerta, ciclos que nunca iteran, bloques vacíos, y
+	// las instrucciones (anidadas incluidas) que contenían las ramas y ciclos muertos.
+	uint64_t deadBranches;
+	uint64_t deadLoops;
+	uint64_t emptyBlocks;
+	uint64_t eliminatedInstructions;
+} CompilationStatistics;
+
+static inline uint64_t monotonicNanoseconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000000000ULL + (uint64_t) now.tv_nsec;
+}
+
+// Inicia la medición de una fase (no hace nada si "statistics" es NULL).
+static inline uint64_t startPhase(const CompilationStatistics *statistics) {
+	return statistics == NULL ? 0 : monotonicNanoseconds();
+}
+
+// Suma a "phase" el tiempo transcurrido desde "start".
+static inline void stopPhase(CompilationStatistics *statistics, CompilerPhase phase, uint64_t start) {
+	if (statistics != NULL) statistics->phaseNanoseconds[phase] += monotonicNanoseconds() - start;
+}
+
+// Acumula las estadísticas de "unit" en "total".
+void addStatistics(CompilationStatistics *total, const CompilationStatistics *unit);
+
+/**
+ * Escribe "statistics" como un objeto JSON:
+ *
+ *	{"phases": {"parsing": segundos, ...},
+ *	 "counters": {"tokens": n, ..., "nodes": n, "nodesByType": {"Program": n, ...}},
+ *	 "deadCode": {"deadBranches": n, ...}}
+ */
+void appendStatisticsJson(const CompilationStatistics *statistics, OutputBuffer *json);
+
+#endif
@@ -0,0 +1,103 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "string-pool.h"
+
+/**
+ * Implementación de "string-pool.h".
+ */
+
+#define STRING_POOL_INITIAL_CAPACITY 256
+
+// Header stored right before the characters of each interned string.
+typedef struct {
+	uint32_t hash;
+	uint32_t length;
+	char text[];
+} InternedString;
+
+static InternedString *headerOf(const char *string) {
+	return (InternedString *) (string - offsetof(InternedString, text));
+}
+
+// FNV-1a
+static uint32_t hashString(const char *string, size_t length) {
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < length; ++i) {
+		hash ^= (unsigned char) string[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+static void growStringPool(StringPool *pool) {
+	size_t capacity = pool->capacity * 2;
+	char **slots = calloc(capacity, sizeof(char *));
+	if (slots == NULL) return;
+
+	for (size_t i = 0; i < pool->capacity; ++i) {
+		char *string = pool->slots[i];
+		if (string == NULL) continue;
+		size_t slot = headerOf(string)->hash & (capacity - 1);
+		while (slots[slot] != NULL) slot = (slot + 1) & (capacity - 1);
+		slots[slot] = string;
+	}
+
+	free(pool->slots);
+	pool->slots = slots;
+	pool->capacity = capacity;
+}
+
+StringPool *createStringPool(Arena *arena) {
+	StringPool *pool = calloc(1, sizeof(StringPool));
+	if (pool == NULL) return NULL;
+	pool->arena = arena;
+	pool->capacity = STRING_POOL_INITIAL_CAPACITY;
+	pool->slots = calloc(pool->capacity, sizeof(char *));
+	return pool;
+}
+
+char *internString(StringPool *pool, const char *string, size_t length) {
+	// Keep the load factor under 1/2
+	if (2 * (pool->count + 1) > pool->capacity) growStringPool(pool);
+
+	uint32_t hash = hashString(string, length);
+	size_t slot = hash & (pool->capacity - 1);
+
+	while (pool->slots[slot] != NULL) {
+		InternedString *candidate = headerOf(pool->slots[slot]);
+		if (candidate->hash == hash && candidate->length == length && memcmp(candidate->text, string, length) == 0)
+			return candidate->text;
+		slot = (slot + 1) & (pool->capacity - 1);
+	}
+
+	InternedString *interned = arenaAllocate(pool->arena, sizeof(InternedString) + length + 1);
+	if (interned == NULL) return NULL;
+	interned->hash = hash;
+	interned->length = (uint32_t) length;
+	memcpy(interned->text, string, length);
+	interned->text[length] = '\0';
+
+	pool->slots[slot] = interned->text;
+	pool->count++;
+	return interned->text;
+}
+
+uint32_t internedStringHash(const char *string) {
+	return headerOf(string)->hash;
+}
+
+size_t internedStringLength(const char *string) {
+	return headerOf(string)->length;
+}
+
+void clearStringPool(StringPool *pool) {
+	memset(pool->slots, 0, pool->capacity * sizeof(char *));
+	pool->count = 0;
+}
+
+void freeStringPool(StringPool *pool) {
+	if (pool == NULL) return;
+	free(pool->slots);
+	free(pool);
+}
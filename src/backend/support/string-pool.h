@@ -0,0 +1,40 @@
+#ifndef STRING_POOL_HEADER
+#define STRING_POOL_HEADER
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "arena.h"
+
+/**
+ * Interning pool for lexemes. Every distinct string is stored once (inside
+ * the arena), together with its hash, so two interned strings are equal if
+ * and only if their pointers are equal.
+ */
+
+typedef struct {
+	Arena *arena;
+
+	// Open addressing table of interned strings (capacity is a power of 2).
+	char **slots;
+	size_t capacity;
+	size_t count;
+} StringPool;
+
+StringPool *createStringPool(Arena *arena);
+
+// Returns the canonical copy of the first "length" characters of "string".
+char *internString(StringPool *pool, const char *string, size_t length);
+
+// Hash computed when the string was interned (only valid for interned strings).
+uint32_t internedStringHash(const char *string);
+
+size_t internedStringLength(const char *string);
+
+// Forgets every interned string (which live in the arena), keeping the table.
+void clearStringPool(StringPool *pool);
+
+// Releases the table. The strings themselves are released with the arena.
+void freeStringPool(StringPool *pool);
+
+#endif
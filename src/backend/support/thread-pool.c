@@ -0,0 +1,71 @@
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "thread-pool.h"
+
+/**
+ * Implementación de "thread-pool.h".
+ */
+
+// Ranges per thread: enough to balance uneven tasks, few enough to keep the
+// synchronization (and the per-range state of the caller) negligible.
+#define RANGES_PER_JOB 4
+
+typedef struct {
+	ParallelTask task;
+	void *context;
+	int count;
+	int rangeSize;
+	int nextStart;
+	pthread_mutex_t lock;
+} ParallelJob;
+
+typedef struct {
+	ParallelJob *job;
+	int worker;
+} ParallelWorker;
+
+static void *parallelWorker(void *argument) {
+	ParallelWorker *worker = argument;
+	ParallelJob *job = worker->job;
+
+	while (1) {
+		pthread_mutex_lock(&job->lock);
+		const int start = job->nextStart;
+		job->nextStart += job->rangeSize;
+		pthread_mutex_unlock(&job->lock);
+		if (start >= job->count) break;
+
+		const int end = job->count - start < job->rangeSize ? job->count : start + job->rangeSize;
+		job->task(job->context, start, end, worker->worker);
+	}
+
+	return NULL;
+}
+
+void parallelFor(int count, int jobs, ParallelTask task, void *context) {
+	if (count <= 0) return;
+	int threadCount = jobs < count ? jobs : count;
+	if (threadCount < 1) threadCount = 1;
+
+	const int ranges = threadCount * RANGES_PER_JOB;
+	ParallelJob job = { task, context, count, (count + ranges - 1) / ranges, 0 };
+	pthread_mutex_init(&job.lock, NULL);
+
+	pthread_t *threads = malloc(threadCount * sizeof(pthread_t));
+	ParallelWorker *workers = malloc(threadCount * sizeof(ParallelWorker));
+
+	// The calling thread is the worker 0, so a single job never starts a thread
+	int started = 1;
+	for (; started < threadCount; ++started) {
+		workers[started] = (ParallelWorker) { &job, started };
+		if (pthread_create(&threads[started], NULL, parallelWorker, &workers[started]) != 0) break;
+	}
+	workers[0] = (ParallelWorker) { &job, 0 };
+	parallelWorker(&workers[0]);
+	for (int i = 1; i < started; ++i) pthread_join(threads[i], NULL);
+
+	free(workers);
+	free(threads);
+	pthread_mutex_destroy(&job.lock);
+}
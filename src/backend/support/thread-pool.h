@@ -0,0 +1,19 @@
+#ifndef THREAD_POOL_HEADER
+#define THREAD_POOL_HEADER
+
+/**
+ * Runs independent tasks (e.g., one per function of a contract) on a pool of
+ * worker threads. The tasks are split in a few contiguous ranges per thread,
+ * and each thread takes the next pending range until none is left, so the
+ * caller must store every result at the index of its task (or range): the
+ * outcome never depends on the scheduling.
+ */
+
+// Runs the tasks in [start, end). "worker" (in [0, jobs)) identifies the thread that runs them.
+typedef void (*ParallelTask)(void *context, int start, int end, int worker);
+
+// Runs "task" over every index in [0, count) on up to "jobs" threads (the
+// calling one included), and returns once all of them have finished.
+void parallelFor(int count, int jobs, ParallelTask task, void *context);
+
+#endif
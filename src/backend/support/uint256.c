@@ -0,0 +1,234 @@
+#include <string.h>
+
+#include "uint256.h"
+
+/**
+ * Implementación de "uint256.h".
+ */
+
+#define LIMB_BITS 32
+#define DECIMAL_CHUNK 1000000000u // 9 digits per division
+#define DECIMAL_CHUNK_DIGITS 9
+
+// Longest exponent worth evaluating (10^78 does not fit anyway).
+#define MAX_EXPONENT_DIGITS 4
+
+UInt256 uint256FromUInt64(uint64_t value) {
+	UInt256 result;
+	memset(&result, 0, sizeof(UInt256));
+	result.limbs[0] = (uint32_t) value;
+	result.limbs[1] = (uint32_t) (value >> LIMB_BITS);
+	return result;
+}
+
+int uint256IsZero(const UInt256 *value) {
+	for (int i = 0; i < UINT256_LIMBS; ++i) {
+		if (value->limbs[i] != 0) return 0;
+	}
+	return 1;
+}
+
+int uint256IsOdd(const UInt256 *value) {
+	return value->limbs[0] & 1;
+}
+
+int uint256FitsInt(const UInt256 *magnitude, int negative) {
+	UInt256 limit = uint256FromUInt64(0);
+	limit.limbs[UINT256_LIMBS - 1] = 1u << (LIMB_BITS - 1); // 2^255
+	const int comparison = uint256Compare(magnitude, &limit);
+	return comparison < 0 || (comparison == 0 && negative);
+}
+
+int uint256Compare(const UInt256 *a, const UInt256 *b) {
+	for (int i = UINT256_LIMBS - 1; i >= 0; --i) {
+		if (a->limbs[i] != b->limbs[i]) return a->limbs[i] < b->limbs[i] ? -1 : 1;
+	}
+	return 0;
+}
+
+int uint256Add(UInt256 *result, const UInt256 *a, const UInt256 *b) {
+	uint64_t carry = 0;
+	for (int i = 0; i < UINT256_LIMBS; ++i) {
+		const uint64_t sum = (uint64_t) a->limbs[i] + b->limbs[i] + carry;
+		result->limbs[i] = (uint32_t) sum;
+		carry = sum >> LIMB_BITS;
+	}
+	return carry == 0;
+}
+
+// Subtracts modulo 2^256 (i.e., wrapping around if "b" is greater than "a").
+static void subtractWrapping(UInt256 *result, const UInt256 *a, const UInt256 *b) {
+	uint64_t borrow = 0;
+	for (int i = 0; i < UINT256_LIMBS; ++i) {
+		const uint64_t difference = (uint64_t) a->limbs[i] - b->limbs[i] - borrow;
+		result->limbs[i] = (uint32_t) difference;
+		borrow = (difference >> LIMB_BITS) & 1;
+	}
+}
+
+int uint256Subtract(UInt256 *result, const UInt256 *a, const UInt256 *b) {
+	if (uint256Compare(a, b) < 0) return 0;
+	subtractWrapping(result, a, b);
+	return 1;
+}
+
+int uint256Multiply(UInt256 *result, const UInt256 *a, const UInt256 *b) {
+	uint32_t product[2 * UINT256_LIMBS] = { 0 };
+	for (int i = 0; i < UINT256_LIMBS; ++i) {
+		if (a->limbs[i] == 0) continue;
+		uint64_t carry = 0;
+		for (int j = 0; j < UINT256_LIMBS; ++j) {
+			const uint64_t partial = (uint64_t) a->limbs[i] * b->limbs[j] + product[i + j] + carry;
+			product[i + j] = (uint32_t) partial;
+			carry = partial >> LIMB_BITS;
+		}
+		product[i + UINT256_LIMBS] = (uint32_t) carry;
+	}
+
+	for (int i = UINT256_LIMBS; i < 2 * UINT256_LIMBS; ++i) {
+		if (product[i] != 0) return 0;
+	}
+	memcpy(result->limbs, product, sizeof(result->limbs));
+	return 1;
+}
+
+// Multiplies "value" by a single limb and adds another one. Returns 0 if the result does not fit.
+static int multiplyAddLimb(UInt256 *value, uint32_t factor, uint32_t addend) {
+	uint64_t carry = addend;
+	for (int i = 0; i < UINT256_LIMBS; ++i) {
+		const uint64_t partial = (uint64_t) value->limbs[i] * factor + carry;
+		value->limbs[i] = (uint32_t) partial;
+		carry = partial >> LIMB_BITS;
+	}
+	return carry == 0;
+}
+
+// Divides "value" by a single limb in place, and returns the remainder.
+static uint32_t divideLimb(UInt256 *value, uint32_t divisor) {
+	uint64_t remainder = 0;
+	for (int i = UINT256_LIMBS - 1; i >= 0; --i) {
+		const uint64_t dividend = (remainder << LIMB_BITS) | value->limbs[i];
+		value->limbs[i] = (uint32_t) (dividend / divisor);
+		remainder = dividend % divisor;
+	}
+	return (uint32_t) remainder;
+}
+
+static int bitAt(const UInt256 *value, int bit) {
+	return (value->limbs[bit / LIMB_BITS] >> (bit % LIMB_BITS)) & 1;
+}
+
+// Bit-by-bit long division: folding evaluates few divisions, so simplicity wins.
+void uint256Divide(UInt256 *quotient, UInt256 *remainder, const UInt256 *a, const UInt256 *b) {
+	UInt256 q = uint256FromUInt64(0);
+	UInt256 r = uint256FromUInt64(0);
+
+	for (int bit = 8 * (int) sizeof(a->limbs) - 1; bit >= 0; --bit) {
+		// r = 2r + bit, remembering the bit shifted out (then r exceeds any "b")
+		const uint32_t carry = r.limbs[UINT256_LIMBS - 1] >> (LIMB_BITS - 1);
+		for (int i = UINT256_LIMBS - 1; i > 0; --i)
+			r.limbs[i] = (r.limbs[i] << 1) | (r.limbs[i - 1] >> (LIMB_BITS - 1));
+		r.limbs[0] = (r.limbs[0] << 1) | (uint32_t) bitAt(a, bit);
+
+		if (carry || uint256Compare(&r, b) >= 0) {
+			subtractWrapping(&r, &r, b);
+			q.limbs[bit / LIMB_BITS] |= 1u << (bit % LIMB_BITS);
+		}
+	}
+
+	if (quotient != NULL) *quotient = q;
+	if (remainder != NULL) *remainder = r;
+}
+
+int uint256Power(UInt256 *result, const UInt256 *base, const UInt256 *exponent) {
+	UInt256 power = uint256FromUInt64(1);
+	UInt256 square = *base;
+	UInt256 remaining = *exponent;
+
+	while (!uint256IsZero(&remaining)) {
+		if (uint256IsOdd(&remaining) && !uint256Multiply(&power, &power, &square)) return 0;
+		divideLimb(&remaining, 2);
+		// A square that does not fit only matters if it is used again
+		if (!uint256IsZero(&remaining) && !uint256Multiply(&square, &square, &square)) return 0;
+	}
+
+	*result = power;
+	return 1;
+}
+
+int uint256FromDecimal(UInt256 *result, const char *digits, size_t length) {
+	UInt256 value = uint256FromUInt64(0);
+	for (size_t i = 0; i < length; ++i) {
+		if (digits[i] < '0' || digits[i] > '9') return 0;
+		if (!multiplyAddLimb(&value, 10, (uint32_t) (digits[i] - '0'))) return 0;
+	}
+	*result = value;
+	return 1;
+}
+
+int uint256FromScientific(UInt256 *result, const char *text, size_t length) {
+	const char *end = text + length;
+	const char *exponent = text;
+	while (exponent < end && *exponent != 'e' && *exponent != 'E') ++exponent;
+	if (exponent == end || end - exponent - 1 > MAX_EXPONENT_DIGITS) return 0;
+
+	// The mantissa without its point (15 in "1.5e3"), read digit by digit
+	UInt256 value = uint256FromUInt64(0);
+	long fractionDigits = -1;
+	for (const char *digit = text; digit < exponent; ++digit) {
+		if (*digit == '.') {
+			fractionDigits = 0;
+			continue;
+		}
+		if (*digit < '0' || *digit > '9' || !multiplyAddLimb(&value, 10, (uint32_t) (*digit - '0'))) return 0;
+		if (fractionDigits >= 0) ++fractionDigits;
+	}
+
+	// Then shifted by the exponent, minus the digits that were after the point
+	long shift = 0;
+	for (const char *digit = exponent + 1; digit < end; ++digit) {
+		if (*digit < '0' || *digit > '9') return 0;
+		shift = 10 * shift + (*digit - '0');
+	}
+	if (fractionDigits > 0) shift -= fractionDigits;
+
+	for (; shift > 0 && !uint256IsZero(&value); --shift) {
+		if (!multiplyAddLimb(&value, 10, 0)) return 0;
+	}
+	for (; shift < 0; ++shift) {
+		if (divideLimb(&value, 10) != 0) return 0;
+	}
+
+	*result = value;
+	return 1;
+}
+
+size_t uint256ToDecimal(const UInt256 *value, char *text) {
+	// Chunks of 9 digits, the least significant first
+	uint32_t chunks[(UINT256_DECIMAL_LENGTH + DECIMAL_CHUNK_DIGITS - 1) / DECIMAL_CHUNK_DIGITS];
+	int count = 0;
+	UInt256 rest = *value;
+	do {
+		chunks[count++] = divideLimb(&rest, DECIMAL_CHUNK);
+	} while (!uint256IsZero(&rest));
+
+	size_t length = 0;
+	for (int i = count - 1; i >= 0; --i) {
+		char digits[DECIMAL_CHUNK_DIGITS];
+		uint32_t chunk = chunks[i];
+		for (int d = DECIMAL_CHUNK_DIGITS - 1; d >= 0; --d) {
+			digits[d] = (char) ('0' + chunk % 10);
+			chunk /= 10;
+		}
+
+		// Only the most significant chunk drops its leading zeros
+		int first = 0;
+		if (i == count - 1)
+			while (first < DECIMAL_CHUNK_DIGITS - 1 && digits[first] == '0') ++first;
+		memcpy(text + length, digits + first, DECIMAL_CHUNK_DIGITS - first);
+		length += DECIMAL_CHUNK_DIGITS - first;
+	}
+
+	text[length] = '\0';
+	return length;
+}
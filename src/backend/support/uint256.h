@@ -0,0 +1,64 @@
+#ifndef UINT256_HEADER
+#define UINT256_HEADER
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Unsigned 256-bit integer, the width of the Solidity "uint" (and, with a
+ * sign, of the "int"). The operations are exact: those that can exceed 256 bits
+ * return 0 instead of wrapping around, and 1 otherwise.
+ */
+
+#define UINT256_LIMBS 8
+
+// Longest decimal representation (2^256 - 1 has 78 digits), without the NUL.
+#define UINT256_DECIMAL_LENGTH 78
+
+typedef struct UInt256 {
+	uint32_t limbs[UINT256_LIMBS]; // the least significant limb first
+} UInt256;
+
+// An exact integer (e.g., a literal), as a sign and a magnitude.
+typedef struct Number {
+	UInt256 magnitude;
+	int negative; // never set on 0
+} Number;
+
+UInt256 uint256FromUInt64(uint64_t value);
+
+int uint256IsZero(const UInt256 *value);
+
+// Returns a negative, zero or positive number if "a" is less, equal or greater than "b".
+int uint256Compare(const UInt256 *a, const UInt256 *b);
+
+int uint256Add(UInt256 *result, const UInt256 *a, const UInt256 *b);
+
+// Returns 0 if "b" is greater than "a".
+int uint256Subtract(UInt256 *result, const UInt256 *a, const UInt256 *b);
+
+int uint256Multiply(UInt256 *result, const UInt256 *a, const UInt256 *b);
+
+// Truncated division ("b" must not be zero). Either result may be NULL.
+void uint256Divide(UInt256 *quotient, UInt256 *remainder, const UInt256 *a, const UInt256 *b);
+
+int uint256Power(UInt256 *result, const UInt256 *base, const UInt256 *exponent);
+
+// Whether "value" is odd (e.g., to know the sign of a negative base raised to it).
+int uint256IsOdd(const UInt256 *value);
+
+// Whether a number of that sign and "magnitude" fits in an "int", i.e., in [-2^255, 2^255).
+int uint256FitsInt(const UInt256 *magnitude, int negative);
+
+// Parses "length" decimal digits. Returns 0 if a character is not a digit, or the number does not fit.
+int uint256FromDecimal(UInt256 *result, const char *digits, size_t length);
+
+// Parses an unsigned literal in scientific notation (e.g., "25e17" or ".5e3").
+// Returns 0 if it is not an integer, or it does not fit.
+int uint256FromScientific(UInt256 *result, const char *text, size_t length);
+
+// Writes the decimal digits of "value" and a NUL into "text" (of at least
+// UINT256_DECIMAL_LENGTH + 1 characters). Returns the number of digits.
+size_t uint256ToDecimal(const UInt256 *value, char *text);
+
+#endif
@@ -0,0 +1,205 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "backend/support/logger.h"
+#include "cache.h"
+
+/**
+ * Implementación de "cache.h".
+ */
+
+// Cambiar si cambia el formato de las entradas. Además, cada build del compilador
+// tiene sus propias claves (ver "hashCompiler"), ya que puede generar otro código.
+#define CACHE_FORMAT "soliditish-cache-2"
+
+// El ejecutable en curso, del que se obtiene la identidad del build
+#define COMPILER_EXECUTABLE "/proc/self/exe"
+
+// Los contadores acumulados: aciertos y fallos, como dos enteros de 64 bits
+#define CACHE_COUNTERS_FILE "counters"
+
+// FNV-1a de 128 bits
+#define FNV128_PRIME (((unsigned __int128) 0x0000000001000000ULL << 64) | 0x000000000000013BULL)
+#define FNV128_OFFSET (((unsigned __int128) 0x6C62272E07BB0142ULL << 64) | 0x62B821756295C58DULL)
+
+static unsigned __int128 hashBytes(unsigned __int128 hash, const void *data, size_t length) {
+	const unsigned char *bytes = data;
+	for (size_t i = 0; i < length; ++i) {
+		hash ^= bytes[i];
+		hash *= FNV128_PRIME;
+	}
+	return hash;
+}
+
+// Hash of the running executable, computed once per process.
+static unsigned __int128 compilerHash = 0;
+static pthread_once_t compilerHashOnce = PTHREAD_ONCE_INIT;
+
+// Any change to the compiler changes its executable, so no build reuses the entries of another.
+static void hashCompiler() {
+	unsigned __int128 hash = FNV128_OFFSET;
+	FILE *executable = fopen(COMPILER_EXECUTABLE, "rb");
+	if (executable == NULL) {
+		LogError("Cannot read the compiler executable: the cache may reuse entries of other builds.");
+	}
+	else {
+		char chunk[65536];
+		size_t read;
+		while ((read = fread(chunk, sizeof(char), sizeof(chunk), executable)) > 0)
+			hash = hashBytes(hash, chunk, read);
+		fclose(executable);
+	}
+	compilerHash = hash;
+}
+
+// "<directory>/<name>", or NULL if the path does not fit.
+static boolean cachePath(char *path, size_t size, const CompilationCache *cache, const char *name) {
+	return snprintf(path, size, "%s/%s", cache->directory, name) < (int) size;
+}
+
+static void entryName(char *name, size_t size, const CacheKey *key) {
+	snprintf(name, size, "%016llx%016llx.sol", (unsigned long long) key->high, (unsigned long long) key->low);
+}
+
+/**
+ * Opens the counters file of the directory and locks it ("operation" is LOCK_SH
+ * or LOCK_EX), reading the totals into "counters" (zero if the file is new).
+ * Returns the descriptor, which releases the lock once closed, or -1.
+ */
+static int lockCounters(const CompilationCache *cache, int operation, uint64_t counters[2]) {
+	char path[4096];
+	counters[0] = counters[1] = 0;
+	if (!cachePath(path, sizeof(path), cache, CACHE_COUNTERS_FILE)) return -1;
+	int fd = open(path, operation == LOCK_EX ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+	if (fd < 0) return -1;
+	while (flock(fd, operation) != 0) {
+		if (errno != EINTR) {
+			close(fd);
+			return -1;
+		}
+	}
+	if (pread(fd, counters, 2 * sizeof(uint64_t), 0) != 2 * sizeof(uint64_t)) counters[0] = counters[1] = 0;
+	return fd;
+}
+
+boolean openCache(CompilationCache *cache, const char *directory) {
+	cache->directory = directory;
+	cache->hits = 0;
+	cache->misses = 0;
+	if (mkdir(directory, 0755) != 0 && errno != EEXIST) {
+		perror("Error creating cache directory");
+		return false;
+	}
+	return true;
+}
+
+CacheKey computeCacheKey(const char *source, size_t length, const CompilerOptions *options) {
+	const int32_t indentationSize = options->indentationSize;
+	const uint8_t flags[] = { options->indentUsingSpaces, options->indentOutput };
+
+	pthread_once(&compilerHashOnce, hashCompiler);
+
+	unsigned __int128 hash = FNV128_OFFSET;
+	hash = hashBytes(hash, CACHE_FORMAT, sizeof(CACHE_FORMAT));
+	hash = hashBytes(hash, &compilerHash, sizeof(compilerHash));
+	hash = hashBytes(hash, &indentationSize, sizeof(indentationSize));
+	hash = hashBytes(hash, flags, sizeof(flags));
+	hash = hashBytes(hash, source, length);
+
+	CacheKey key = { (uint64_t) (hash >> 64), (uint64_t) hash };
+	return key;
+}
+
+boolean restoreCachedOutput(CompilationCache *cache, const CacheKey *key, const char *outFileName) {
+	char name[64];
+	char path[4096];
+	entryName(name, sizeof(name), key);
+
+	FILE *entry = cachePath(path, sizeof(path), cache, name) ? fopen(path, "rb") : NULL;
+	struct stat status;
+	char *output = NULL;
+	boolean found = entry != NULL && fstat(fileno(entry), &status) == 0 && (output = malloc(status.st_size + 1)) != NULL
+		&& fread(output, sizeof(char), status.st_size, entry) == (size_t) status.st_size;
+	if (entry != NULL) fclose(entry);
+
+	if (found) {
+		// Create or overwrite output file, with a single write for the whole program
+		FILE *outputFile = fopen(outFileName, "w");
+		if (outputFile == NULL) {
+			perror("Error opening output file");
+			found = false;
+		}
+		else {
+			fwrite(output, sizeof(char), status.st_size, outputFile);
+			fclose(outputFile);
+		}
+	}
+	free(output);
+
+	__sync_fetch_and_add(found ? &cache->hits : &cache->misses, 1);
+	return found;
+}
+
+void storeCachedOutput(CompilationCache *cache, const CacheKey *key, const char *output, size_t length) {
+	char name[64];
+	char path[4096];
+	char temporaryPath[4096];
+	entryName(name, sizeof(name), key);
+	if (!cachePath(path, sizeof(path), cache, name)) return;
+	if (snprintf(temporaryPath, sizeof(temporaryPath), "%s/.%s.XXXXXX", cache->directory, name) >= (int) sizeof(temporaryPath)) return;
+
+	// Write the whole entry under a unique name, then publish it atomically
+	int fd = mkstemp(temporaryPath);
+	if (fd < 0) {
+		perror("Error creating cache entry");
+		return;
+	}
+	fchmod(fd, 0644);
+
+	boolean written = true;
+	for (size_t offset = 0; written && offset < length;) {
+		ssize_t count = write(fd, output + offset, length - offset);
+		if (count < 0 && errno == EINTR) continue;
+		written = count > 0;
+		offset += written ? count : 0;
+	}
+	if (close(fd) != 0) written = false;
+
+	if (!written || rename(temporaryPath, path) != 0) {
+		perror("Error storing cache entry");
+		unlink(temporaryPath);
+	}
+}
+
+void closeCache(const CompilationCache *cache) {
+	if (cache->directory == NULL || cache->hits + cache->misses == 0) return;
+
+	uint64_t counters[2];
+	int fd = lockCounters(cache, LOCK_EX, counters);
+	if (fd < 0) return;
+	counters[0] += cache->hits;
+	counters[1] += cache->misses;
+	if (pwrite(fd, counters, sizeof(counters), 0) < 0) { /* the totals are only informative */ }
+	close(fd);
+}
+
+void logCacheStatistics(const CompilationCache *cache) {
+	if (cache->directory == NULL) {
+		LogInfo("Cache statistics: no cache directory (see --cache-dir).");
+		return;
+	}
+	LogInfo("Cache statistics ('%s'):", cache->directory);
+	LogRaw("- This run: %d hits, %d misses\n", cache->hits, cache->misses);
+
+	uint64_t counters[2];
+	int fd = lockCounters(cache, LOCK_SH, counters);
+	if (fd >= 0) close(fd);
+	LogRaw("- All runs: %llu hits, %llu misses\n", (unsigned long long) counters[0], (unsigned long long) counters[1]);
+}
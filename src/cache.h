@@ -0,0 +1,61 @@
+#ifndef CACHE_HEADER
+#define CACHE_HEADER
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "compiler.h"
+
+/**
+ * Caché de compilaciones en disco. La clave es un hash de 128 bits del código
+ * fuente junto con las opciones de generación (tamaño de indentación, tabs y
+ * minificación) y el ejecutable del compilador, y el valor es el programa Solidity generado, guardado como
+ * "<directorio>/<clave>.sol". Ante un acierto, la salida se copia sin escanear,
+ * parsear, verificar tipos ni generar código.
+ *
+ * Cada entrada se escribe en un archivo temporal del mismo directorio y se
+ * publica con "rename", que es atómico: varios procesos pueden compartir el
+ * directorio y ninguno lee una entrada a medio escribir. Solo se guardan las
+ * compilaciones exitosas.
+ */
+
+typedef struct {
+	uint64_t high;
+	uint64_t low;
+} CacheKey;
+
+typedef struct {
+	const char *directory;
+
+	// Aciertos y fallos de este proceso (actualizados por todos los workers)
+	int hits;
+	int misses;
+} CompilationCache;
+
+// Crea el directorio de la caché si no existe.
+boolean openCache(CompilationCache *cache, const char *directory);
+
+CacheKey computeCacheKey(const char *source, size_t length, const CompilerOptions *options);
+
+/**
+ * Si la caché tiene una salida para "key", la copia en "outFileName" y retorna
+ * true. Cuenta el acierto o el fallo.
+ */
+boolean restoreCachedOutput(CompilationCache *cache, const CacheKey *key, const char *outFileName);
+
+void storeCachedOutput(CompilationCache *cache, const CacheKey *key, const char *output, size_t length);
+
+/**
+ * Suma los aciertos y fallos de este proceso a los acumulados del directorio,
+ * un archivo de tamaño fijo que se actualiza con un lock (ver "flock"). Se
+ * llama una vez, al terminar el proceso.
+ */
+void closeCache(const CompilationCache *cache);
+
+/**
+ * Informa los aciertos y fallos de este proceso, y los acumulados por todos los
+ * procesos que usaron el mismo directorio (incluido este, si ya se cerró la caché).
+ */
+void logCacheStatistics(const CompilationCache *cache);
+
+#endif
@@ -0,0 +1,233 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "backend/code-generation/generator.h"
+#include "backend/optimization/constant-folding.h"
+#include "backend/optimization/dead-code-elimination.h"
+#include "backend/optimization/loop-optimization.h"
+#include "backend/optimization/storage-caching.h"
+#include "backend/semantic-analysis/semantic-analysis.h"
+#include "backend/semantic-analysis/symbol-table.h"
+#include "frontend/lexical-analysis/source-input.h"
+#include "frontend/syntactic-analysis/bison-parser.h"
+#include "compiler.h"
+
+/**
+ * Implementación de "compiler.h".
+ */
+
+struct CompilerSession {
+	Arena *arena;
+	StringPool *strings;
+};
+
+// "session" may be NULL, in which case the compilation gets its own memory.
+static void initializeState(CompilerState *state, const CompilerOptions *options, CompilerSession *session) {
+	memset(state, 0, sizeof(CompilerState));
+	state->program = NULL;
+	state->succeed = false;
+	state->options = options;
+	state->session = session;
+	if (session != NULL) {
+		state->arena = session->arena;
+		state->strings = session->strings;
+	}
+	else {
+		state->arena = createArena();
+		state->strings = createStringPool(state->arena);
+	}
+	yylex_init_extra(state, &state->scanner);
+}
+
+static void freeResources(CompilerState *state) {
+	freeSymbolTable(state);
+	for (int i = 0; i < state->workerArenaCount; ++i) freeArena(state->workerArenas[i]);
+	free(state->workerArenas);
+	if (state->session != NULL) {
+		// Keep the memory of the session for its next compilation
+		clearStringPool(state->strings);
+		resetArena(state->arena);
+	}
+	else {
+		freeStringPool(state->strings);
+		freeArena(state->arena); // releases the whole AST and every lexeme at once
+	}
+	for (int i = 0; i < state->errorCount; ++i) {
+		free(state->errors[i].message);
+		free(state->errors[i].lexeme);
+	}
+	if (state->scanner != NULL) yylex_destroy(state->scanner);
+	memset(state, 0, sizeof(CompilerState));
+}
+
+// Parses the input already loaded in the scanner and, if it is valid, generates its code.
+static int compile(CompilerState *state, SourceInput *input, CompilationResult *result) {
+	CompilationStatistics *statistics = state->options->collectStatistics ? &result->statistics : NULL;
+	state->statistics = statistics;
+
+	uint64_t start = startPhase(statistics);
+	const int status = yyparse(state->scanner, state);
+	closeSourceInput(input);
+	stopPhase(statistics, PHASE_PARSING, start);
+
+	// The semantic analysis runs over the whole AST, once the parser built it
+	if (status == 0 && state->succeed) {
+		start = startPhase(statistics);
+		state->succeed = AnalyzeProgram(state);
+		stopPhase(statistics, PHASE_SEMANTIC_ANALYSIS, start);
+	}
+
+	// Then the constant operations of the (well-typed) program are folded,
+	// which may leave branches and loops that never run. The code left then
+	// reads state variables from local copies where it can, and the loops are
+	// prepared to be generated with cheaper iterations
+	if (status == 0 && state->succeed) {
+		start = startPhase(statistics);
+		state->succeed = FoldConstants(state);
+		if (state->succeed) {
+			EliminateDeadCode(state);
+			CacheStorageReads(state);
+			OptimizeLoops(state);
+		}
+		stopPhase(statistics, PHASE_OPTIMIZATION, start);
+	}
+
+	result->status = status == 0 && !state->succeed ? -1 : status;
+
+	if (result->status == 0) {
+		OutputBuffer output;
+		initOutputBuffer(&output);
+		start = startPhase(statistics);
+		GenerateToBuffer(state, &output);
+		stopPhase(statistics, PHASE_CODE_GENERATION, start);
+		result->output = output.data; // the result takes ownership of the buffer
+		result->outputLength = output.length;
+	}
+
+	// The result takes ownership of the messages as well
+	if (state->errorCount > 0) {
+		result->diagnostics = malloc(state->errorCount * sizeof(Diagnostic));
+		memcpy(result->diagnostics, state->errors, state->errorCount * sizeof(Diagnostic));
+		result->diagnosticCount = state->errorCount;
+		state->errorCount = 0;
+	}
+
+	if (statistics != NULL) {
+		statistics->arenaBytes = arenaBytesUsed(state->arena);
+		statistics->bytesWritten = result->outputLength;
+	}
+
+	start = startPhase(statistics);
+	freeResources(state);
+	stopPhase(statistics, PHASE_CLEANUP, start);
+	return result->status;
+}
+
+int compileBuffer(const char *source, size_t length, const CompilerOptions *options, CompilationResult *result) {
+	return compileBufferInSession(NULL, source, length, options, result);
+}
+
+int compileBufferInSession(CompilerSession *session, const char *source, size_t length, const CompilerOptions *options, CompilationResult *result) {
+	memset(result, 0, sizeof(CompilationResult));
+
+	CompilerState state;
+	initializeState(&state, options, session);
+
+	SourceInput input;
+	if (!openSourceBuffer(&input, source, length, state.scanner)) {
+		freeResources(&state);
+		return result->status = 2;
+	}
+
+	return compile(&state, &input, result);
+}
+
+int compileFile(const char *path, const CompilerOptions *options, CompilationResult *result) {
+	memset(result, 0, sizeof(CompilationResult));
+
+	CompilerState state;
+	initializeState(&state, options, NULL);
+
+	// Scan the input file from memory, or fall back to stdin
+	SourceInput input;
+	if (!openSourceInput(&input, path, state.scanner)) {
+		freeResources(&state);
+		return result->status = COMPILATION_INPUT_ERROR;
+	}
+
+	return compile(&state, &input, result);
+}
+
+void freeCompilationResult(CompilationResult *result) {
+	free(result->output);
+	for (int i = 0; i < result->diagnosticCount; ++i) {
+		free(result->diagnostics[i].message);
+		free(result->diagnostics[i].lexeme);
+	}
+	free(result->diagnostics);
+	memset(result, 0, sizeof(CompilationResult));
+}
+
+static void appendString(OutputBuffer *text, const char *string) {
+	appendToBuffer(text, string, strlen(string));
+}
+
+static void appendFormat(OutputBuffer *text, const char *format, ...) {
+	va_list arguments;
+	va_start(arguments, format);
+	appendFormatToBuffer(text, format, arguments);
+	va_end(arguments);
+}
+
+void formatDiagnostics(const CompilationResult *result, OutputBuffer *text) {
+	for (int i = 0; i < result->diagnosticCount; ++i) {
+		const Diagnostic *error = &result->diagnostics[i];
+		if (error->type != DIAGNOSTIC_SYNTAX_ERROR) continue;
+		appendString(text, "[ERROR] Message: '");
+		appendString(text, error->message);
+		appendString(text, "', due to '");
+		for (const char *c = error->lexeme; *c != '\0'; ++c) {
+			if (*c == '\n') appendString(text, "\\n");
+			else appendToBuffer(text, c, 1);
+		}
+		appendFormat(text, "' (length = %zu, line %d).\n\n", strlen(error->lexeme), error->line);
+	}
+
+	switch (result->status) {
+		case 0:
+			break;
+		case -1:
+			appendFormat(text, "[ERROR] Found %d compilation errors:\n", result->diagnosticCount);
+			for (int i = 0; i < result->diagnosticCount; ++i) {
+				appendFormat(text, "Line %d: ", result->diagnostics[i].line);
+				appendString(text, result->diagnostics[i].message);
+				appendString(text, ".\n");
+			}
+			break;
+		case 1:
+			appendString(text, "[ERROR] [Bison] Syntax error.\n");
+			break;
+		case 2:
+			appendString(text, "[ERROR] [Bison] Out of memory.\n");
+			break;
+		default:
+			appendFormat(text, "[ERROR] [Bison] Unknown error (code %d).\n", result->status);
+	}
+}
+
+CompilerSession *createCompilerSession() {
+	CompilerSession *session = calloc(1, sizeof(CompilerSession));
+	if (session == NULL) return NULL;
+	session->arena = createArena();
+	session->strings = createStringPool(session->arena);
+	return session;
+}
+
+void freeCompilerSession(CompilerSession *session) {
+	if (session == NULL) return;
+	freeStringPool(session->strings);
+	freeArena(session->arena);
+	free(session);
+}
@@ -0,0 +1,75 @@
+#ifndef COMPILER_HEADER
+#define COMPILER_HEADER
+
+#include <stddef.h>
+
+#include "backend/support/output-buffer.h"
+#include "backend/support/shared.h"
+
+/**
+ * API de la biblioteca "libsoliditish". Cada llamada compila una unidad con
+ * su propio estado, sin variables globales ni archivos intermedios: el código
+ * generado y los errores se devuelven en memoria. Se puede llamar varias veces
+ * en un mismo proceso, y desde varios hilos a la vez.
+ */
+
+// Resultado de una compilación cuya entrada no se pudo leer.
+#define COMPILATION_INPUT_ERROR -2
+
+// Opciones por defecto (4 espacios de indentación, sin estadísticas, un hilo).
+#define DEFAULT_COMPILER_OPTIONS { 4, true, true, false, 1 }
+
+typedef struct {
+	// 0 si compiló, -1 ante errores semánticos, -2 si no se pudo leer la entrada,
+	// o el resultado no nulo de Bison (1 ante errores de sintaxis, 2 si se agotó
+	// la memoria).
+	int status;
+
+	// El programa Solidity generado (NULL si la compilación falló).
+	char *output;
+	size_t outputLength;
+
+	// Los errores encontrados, en el orden en que se detectaron.
+	Diagnostic *diagnostics;
+	int diagnosticCount;
+
+	// Tiempos y contadores de cada fase (en cero, salvo que las opciones pidan
+	// "collectStatistics").
+	CompilationStatistics statistics;
+} CompilationResult;
+
+/**
+ * Compila los "length" bytes de "source". Retorna el estado de la compilación,
+ * que también queda en "result" (que debe liberarse con "freeCompilationResult").
+ */
+int compileBuffer(const char *source, size_t length, const CompilerOptions *options, CompilationResult *result);
+
+/**
+ * Igual que "compileBuffer", pero escanea directamente el archivo en "path" (o
+ * stdin, si es NULL).
+ */
+int compileFile(const char *path, const CompilerOptions *options, CompilationResult *result);
+
+void freeCompilationResult(CompilationResult *result);
+
+/**
+ * Escribe en "text" los errores de "result", tal como los informa el
+ * ejecutable "Compiler" por la salida de error.
+ */
+void formatDiagnostics(const CompilationResult *result, OutputBuffer *text);
+
+/**
+ * Una sesión conserva la memoria de trabajo (la arena y la tabla de strings)
+ * entre compilaciones, de modo que un proceso de larga vida no vuelve a pedirla
+ * al sistema en cada una. Una sesión no puede usarse desde dos hilos a la vez.
+ */
+typedef struct CompilerSession CompilerSession;
+
+CompilerSession *createCompilerSession();
+
+// Igual que "compileBuffer", pero con la memoria de "session".
+int compileBufferInSession(CompilerSession *session, const char *source, size_t length, const CompilerOptions *options, CompilationResult *result);
+
+void freeCompilerSession(CompilerSession *session);
+
+#endif
@@ -2,6 +2,7 @@
 #include <string.h>
 
 #include "../../backend/support/logger.h"
+#include "../../backend/support/uint256.h"
 #include "flex-actions.h"
 
 /**
@@ -11,59 +12,68 @@
  * de tokens hacia Bison:
  *
  *	1) Computar los atributos del token y almacenarlos donde sea conveniente
- *		(en la tabla de símbolos, en "yylval", o en ambos).
+ *		(en la tabla de símbolos, en "semanticValue", o en ambos).
  *	2) Retornar el token que identifica el terminal identificado.
  *
  * Bison utilizará el token retornado en el punto (2) para matchear dicho
- * terminal en la gramática. Por otro lado, el valor almacenado en "yylval" es
- * el que Bison proveerá como valor semántico al realizar una reducción
- * (mediante $1, $2, $3, etc.).
+ * terminal en la gramática. Por otro lado, el valor almacenado en
+ * "semanticValue" (el "yylval" del parser) es el que Bison proveerá como valor
+ * semántico al realizar una reducción (mediante $1, $2, $3, etc.).
  */
 
 void BeginCommentPatternAction() {}
 
 void EndCommentPatternAction() {}
 
-token TokenPatternAction(const char *lexeme, token token) {
-	yylval.token = token;
+token TokenPatternAction(YYSTYPE *semanticValue, const char *lexeme, token token) {
+	semanticValue->token = token;
 	return token;
 }
 
-token StringValuePatternAction(const char *lexeme, const int length, token token) {
-	yylval.string = strndup(lexeme, length);
+token StringValuePatternAction(CompilerState *state, YYSTYPE *semanticValue, const char *lexeme, const int length, token token) {
+	semanticValue->string = internString(state->strings, lexeme, length);
 	return token;
 }
 
-token DecoratorPatternAction(const char *lexeme, const int length) {
-	yylval.string = strndup(lexeme + 1, length - 1); // ignore leading '@'
+token DecoratorPatternAction(CompilerState *state, YYSTYPE *semanticValue, const char *lexeme, const int length) {
+	semanticValue->string = internString(state->strings, lexeme + 1, length - 1); // ignore leading '@'
 	return DECORATOR;
 }
 
-token BooleanPatternAction(const char *lexeme, const int length) {
-	char *lexemeCopy = strndup(lexeme, length);
-	yylval.integer = strncmp(lexemeCopy, "true", length) == 0; // 1 = true, 0 = false
-	free(lexemeCopy);
+token BooleanPatternAction(YYSTYPE *semanticValue, const char *lexeme, const int length) {
+	semanticValue->integer = strncmp(lexeme, "true", length) == 0; // 1 = true, 0 = false
 	return BOOLEAN;
 }
 
-token IntegerPatternAction(const char *lexeme, const int length) {
-	char *lexemeCopy = strndup(lexeme, length);
-	yylval.integer = atoi(lexemeCopy);
-	free(lexemeCopy);
-	return INTEGER;
+// El valor exacto del literal se lee del lexema, sin copiarlo. Si no es un
+// entero que entra en un "uint" (o en un "int", si es negativo), el valor
+// semántico es NULL, y el análisis semántico reporta el error.
+token NumberPatternAction(CompilerState *state, YYSTYPE *semanticValue, const char *lexeme, const int length, token token) {
+	const int negative = lexeme[0] == '-';
+	const char *digits = lexeme + negative;
+	Number number;
+	const int parsed = token == INTEGER
+		? uint256FromDecimal(&number.magnitude, digits, length - negative)
+		: uint256FromScientific(&number.magnitude, digits, length - negative);
+	number.negative = negative && !uint256IsZero(&number.magnitude);
+
+	if (!parsed || (number.negative && !uint256FitsInt(&number.magnitude, true))) {
+		semanticValue->number = NULL;
+	}
+	else {
+		semanticValue->number = arenaAllocate(state->arena, sizeof(Number));
+		*semanticValue->number = number;
+	}
+	return token;
 }
 
-token UnknownPatternAction(const char *lexeme, const int length) {
-	char *lexemeCopy = strndup(lexeme, length);
-	free(lexemeCopy);
-	yylval.token = ERROR;
+token UnknownPatternAction(YYSTYPE *semanticValue, const char *lexeme, const int length) {
+	semanticValue->token = ERROR;
 	// Al emitir este token, el compilador aborta la ejecución.
 	return ERROR;
 }
 
 void IgnoredPatternAction(const char *lexeme, const int length) {
-	char *lexemeCopy = strndup(lexeme, length);
-	free(lexemeCopy);
 	// Como no debe hacer nada con el patrón, solo se loguea en consola.
 	// No se emite ningún token.
 }
@@ -17,6 +17,10 @@
  * emplean el parámetro adicional "length". Esto es útil cuando se desea
  * asignar memoria dinámica, y por lo tanto, se debe saber exactamente el
  * largo de aquello que se va a almacenar.
+ *
+ * El scanner es reentrante: el valor semántico del token se escribe en
+ * "semanticValue" (el "yylval" de Bison), y las acciones que necesitan el
+ * estado de la compilación lo reciben como parámetro.
  */
 
 // Bloque de comentarios multilínea.
@@ -24,15 +28,16 @@ void BeginCommentPatternAction();
 void EndCommentPatternAction();
 
 // Patrones terminales del lenguaje diseñado.
-token TokenPatternAction(const char *lexeme, token token);
-token StringValuePatternAction(const char *lexeme, const int length, token token);
+token TokenPatternAction(YYSTYPE *semanticValue, const char *lexeme, token token);
+token StringValuePatternAction(CompilerState *state, YYSTYPE *semanticValue, const char *lexeme, const int length, token token);
 
-token IntegerPatternAction(const char *lexeme, const int length);
+token BooleanPatternAction(YYSTYPE *semanticValue, const char *lexeme, const int length);
+token NumberPatternAction(CompilerState *state, YYSTYPE *semanticValue, const char *lexeme, const int length, token token);
 
-token DecoratorPatternAction(const char *lexeme, const int length);
+token DecoratorPatternAction(CompilerState *state, YYSTYPE *semanticValue, const char *lexeme, const int length);
 
 // Patrón desconocido, permite abortar debido a un error de sintaxis.
-token UnknownPatternAction(const char *lexeme, const int length);
+token UnknownPatternAction(YYSTYPE *semanticValue, const char *lexeme, const int length);
 
 // Regla que no hace nada, permite ignorar parte de la entrada.
 void IgnoredPatternAction(const char *lexeme, const int length);
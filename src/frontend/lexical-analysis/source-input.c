@@ -0,0 +1,129 @@
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../../backend/support/logger.h"
+#include "source-input.h"
+
+/**
+ * Implementación de "source-input.h".
+ */
+
+// Flex requiere que el buffer termine con 2 caracteres YY_END_OF_BUFFER_CHAR.
+#define SCANNER_PADDING 2
+
+/**
+ * Reserva una región anónima (inicializada en cero) del tamaño del archivo
+ * más el padding, y mapea el archivo sobre su comienzo. Los bytes posteriores
+ * al fin del archivo quedan en cero, tanto si caen en la última página del
+ * archivo como en la página anónima siguiente.
+ */
+static boolean mapFile(SourceInput *input, int fd, size_t length) {
+	size_t pageSize = (size_t) sysconf(_SC_PAGESIZE);
+	size_t capacity = (length + SCANNER_PADDING + pageSize - 1) / pageSize * pageSize;
+
+	char *region = mmap(NULL, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (region == MAP_FAILED) return false;
+
+	// Flex escribe temporalmente sobre el buffer, por eso el mapeo es privado (copy-on-write)
+	if (length > 0 && mmap(region, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+		munmap(region, capacity);
+		return false;
+	}
+
+	input->data = region;
+	input->length = length;
+	input->capacity = capacity;
+	input->isMapped = true;
+	return true;
+}
+
+// Alternativa para archivos que no se pueden mapear (pipes, dispositivos, etc.).
+static boolean readFile(SourceInput *input, int fd) {
+	size_t capacity = 64 * 1024;
+	size_t length = 0;
+	char *data = malloc(capacity);
+	if (data == NULL) return false;
+
+	ssize_t count;
+	while ((count = read(fd, data + length, capacity - length - SCANNER_PADDING)) > 0) {
+		length += count;
+		if (capacity - length - SCANNER_PADDING == 0) {
+			capacity *= 2;
+			char *grown = realloc(data, capacity);
+			if (grown == NULL) {
+				free(data);
+				return false;
+			}
+			data = grown;
+		}
+	}
+	if (count < 0) {
+		free(data);
+		return false;
+	}
+
+	memset(data + length, 0, SCANNER_PADDING);
+	input->data = data;
+	input->length = length;
+	input->capacity = capacity;
+	input->isMapped = false;
+	return true;
+}
+
+boolean openSourceInput(SourceInput *input, const char *path, yyscan_t scanner) {
+	memset(input, 0, sizeof(SourceInput));
+
+	int fd = path == NULL ? STDIN_FILENO : open(path, O_RDONLY);
+	if (fd < 0) {
+		perror("Error opening input file");
+		return false;
+	}
+
+	struct stat status;
+	boolean loaded = false;
+	if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode))
+		loaded = mapFile(input, fd, (size_t) status.st_size);
+	if (!loaded)
+		loaded = readFile(input, fd);
+
+	// El mapeo se mantiene aun después de cerrar el descriptor
+	if (path != NULL) close(fd);
+
+	if (!loaded) {
+		LogError("Could not read input file '%s'.", path == NULL ? "stdin" : path);
+		return false;
+	}
+
+	input->scanner = scanner;
+	input->scannerBuffer = yy_scan_buffer(input->data, input->length + SCANNER_PADDING, scanner);
+	return true;
+}
+
+boolean openSourceBuffer(SourceInput *input, const char *source, size_t length, yyscan_t scanner) {
+	memset(input, 0, sizeof(SourceInput));
+
+	// Flex escribe sobre el buffer, por lo que no se puede escanear el del llamador
+	char *data = malloc(length + SCANNER_PADDING);
+	if (data == NULL) return false;
+	memcpy(data, source, length);
+	memset(data + length, 0, SCANNER_PADDING);
+
+	input->data = data;
+	input->length = length;
+	input->capacity = length + SCANNER_PADDING;
+	input->isMapped = false;
+	input->scanner = scanner;
+	input->scannerBuffer = yy_scan_buffer(input->data, input->length + SCANNER_PADDING, scanner);
+	return true;
+}
+
+void closeSourceInput(SourceInput *input) {
+	if (input->scannerBuffer != NULL) yy_delete_buffer(input->scannerBuffer, input->scanner);
+	if (input->isMapped) munmap(input->data, input->capacity);
+	else free(input->data);
+	memset(input, 0, sizeof(SourceInput));
+}
@@ -0,0 +1,37 @@
+#ifndef SOURCE_INPUT_HEADER
+#define SOURCE_INPUT_HEADER
+
+#include <stddef.h>
+
+#include "../../backend/support/shared.h"
+
+/**
+ * Entrada del scanner desde un archivo. El contenido se mapea en memoria
+ * (mmap) seguido de los dos bytes nulos que exige "yy_scan_buffer", de modo
+ * que Flex escanea directamente sobre el archivo, sin copias ni recargas.
+ */
+
+typedef struct {
+	// Contenido del archivo, seguido de 2 bytes '\0'.
+	char *data;
+	size_t length;
+
+	// Tamaño de la región reservada (si fue mapeada) o del buffer alojado.
+	size_t capacity;
+	boolean isMapped;
+
+	// El scanner que lee el archivo, y su buffer.
+	yyscan_t scanner;
+	YY_BUFFER_STATE scannerBuffer;
+} SourceInput;
+
+// Prepara a "scanner" para escanear el archivo en "path" (o stdin, si es NULL).
+// Retorna false si no se pudo abrir.
+boolean openSourceInput(SourceInput *input, const char *path, yyscan_t scanner);
+
+// Prepara a "scanner" para escanear una copia de "source".
+boolean openSourceBuffer(SourceInput *input, const char *source, size_t length, yyscan_t scanner);
+
+void closeSourceInput(SourceInput *input);
+
+#endif
@@ -1,45 +1,48 @@
-#include <stdio.h>
 #include <string.h>
-#include <stdlib.h>
 
 #include "../../backend/domain-specific/builtins.h"
-#include "../../backend/semantic-analysis/symbol-table.h"
 #include "../../backend/support/logger.h"
-#include "../../backend/semantic-analysis/type-checking.h"
 #include "bison-actions.h"
 
-#define MAX_ERROR_LENGTH 150
+#define LIST_INITIAL_CAPACITY 4
 
 /**
  * Implementación de "bison-actions.h".
  */
 
-char ERR_MSG[MAX_ERROR_LENGTH];
+// Reserva un nodo del AST junto a los demás nodos de su tipo (que quedan
+// contiguos, como en un arreglo), y lo cuenta si se recolectan estadísticas.
+static void *newNode(CompilerState *state, size_t size, NodeType type) {
+	if (state->statistics != NULL) ++state->statistics->nodes[type];
+	return arenaSlabAllocate(state->arena, &state->nodeSlabs[type], size);
+}
+
+// Hace lugar para un elemento más al final de una lista de "count" elementos de
+// "itemSize" bytes, duplicando su capacidad cuando se llena.
+static void *growList(CompilerState *state, void *items, int count, int *capacity, size_t itemSize) {
+	if (count < *capacity) return items;
+	const int newCapacity = *capacity == 0 ? LIST_INITIAL_CAPACITY : 2 * *capacity;
+	items = arenaGrow(state->arena, items, *capacity * itemSize, newCapacity * itemSize);
+	*capacity = newCapacity;
+	return items;
+}
 
-void addError(int errorLength) {
-	if (state.errorCount == MAX_ERRORS) return;
-	state.errors[state.errorCount] = malloc(sizeof(char) * (errorLength + 13));
-	sprintf(
-		state.errors[state.errorCount],
-		"Line %d: %s.", yylineno, ERR_MSG
-	);
-	state.errorCount++;
+// La línea en la que se construye un nodo, que el análisis semántico usa en sus diagnósticos.
+static int currentLine(CompilerState *state) {
+	return yyget_lineno(state->scanner);
 }
 
 /**
-* Esta función se ejecuta cada vez que se emite un error de sintaxis.
+* Esta función se ejecuta cada vez que se emite un error de sintaxis. El error
+* se registra en el estado de la compilación, junto al lexema que lo produjo.
 */
-void yyerror(const char * string) {
-	LogErrorRaw("[ERROR] Message: '%s', due to '", string);
-	for (int i = 0; i < yyleng; ++i) {
-		switch (yytext[i]) {
-			case '\n':
-				LogErrorRaw("\\n");
-			default:
-				LogErrorRaw("%c", yytext[i]);
-		}
-	}
-	LogErrorRaw("' (length = %d, line %d).\n\n", yyleng, yylineno);
+void yyerror(yyscan_t scanner, CompilerState *state, const char * string) {
+	if (state->errorCount == MAX_ERRORS) return;
+	Diagnostic *error = &state->errors[state->errorCount++];
+	error->type = DIAGNOSTIC_SYNTAX_ERROR;
+	error->line = yyget_lineno(scanner);
+	error->message = strdup(string);
+	error->lexeme = yyget_text(scanner) == NULL ? strdup("") : strndup(yyget_text(scanner), yyget_leng(scanner));
 }
 
 /**
@@ -48,166 +51,153 @@ void yyerror(const char * string) {
 * indica que efectivamente el programa de entrada se pudo generar con esta
 * gramática, o lo que es lo mismo, que el programa pertenece al lenguaje.
 */
-Program *ProgramGrammarAction(struct ContractDefinition *contract) {
-	Program *program = calloc(1, sizeof(Program));
+Program *ProgramGrammarAction(CompilerState *state, struct ContractDefinition *contract) {
+	Program *program = newNode(state, sizeof(Program), NODE_PROGRAM);
 	program->contract = contract;
-	state.program = program;
+	state->program = program;
 	/*
-	* "state" es una variable global que almacena el estado del compilador,
-	* cuyo campo "succeed" indica si la compilación fue o no exitosa, la cual
-	* es utilizada en la función "main".
+	* "state" almacena el estado de la compilación en curso, cuyo campo
+	* "succeed" indica si la compilación fue o no exitosa, la cual es utilizada
+	* en la función "compileFile". El análisis semántico, que se ejecuta luego
+	* del parsing, lo actualiza con los errores que encuentre.
 	*/
-	state.succeed = state.errorCount == 0;
+	state->succeed = state->errorCount == 0;
 	return program;
 }
 
-ContractDefinition *ContractDefinitionGrammarAction(char *identifier, ContractBlock *block) {
-	ContractDefinition *contractDefinition = calloc(1, sizeof(ContractDefinition));
+ContractDefinition *ContractDefinitionGrammarAction(CompilerState *state, char *identifier, ContractBlock *block) {
+	ContractDefinition *contractDefinition = newNode(state, sizeof(ContractDefinition), NODE_CONTRACT_DEFINITION);
 	contractDefinition->identifier = identifier;
 	contractDefinition->block = block;
 	return contractDefinition;
 }
 
-ContractBlock *ContractBlockGrammarAction(ContractInstructions *instructions) {
-	ContractBlock *contractBlock = calloc(1, sizeof(ContractBlock));
+ContractBlock *ContractBlockGrammarAction(CompilerState *state, ContractInstructions *instructions) {
+	ContractBlock *contractBlock = newNode(state, sizeof(ContractBlock), NODE_CONTRACT_BLOCK);
 	contractBlock->instructions = instructions;
 	return contractBlock;
 }
 
-FunctionBlock *FunctionBlockGrammarAction(FunctionInstructions *instructions) {
-	FunctionBlock *functionBlock = calloc(1, sizeof(FunctionBlock));
+FunctionBlock *FunctionBlockGrammarAction(CompilerState *state, FunctionInstructions *instructions) {
+	FunctionBlock *functionBlock = newNode(state, sizeof(FunctionBlock), NODE_FUNCTION_BLOCK);
 	functionBlock->instructions = instructions;
 	return functionBlock;
 }
 
-Conditional *ConditionalGrammarAction(Expression *condition, FunctionBlock *ifBlock, FunctionBlock *elseBlock) {
-	Conditional *conditional = calloc(1, sizeof(Conditional));
+Conditional *ConditionalGrammarAction(CompilerState *state, Expression *condition, FunctionBlock *ifBlock, FunctionBlock *elseBlock) {
+	Conditional *conditional = newNode(state, sizeof(Conditional), NODE_CONDITIONAL);
 	conditional->type = elseBlock == NULL ? CONDITIONAL_NO_ELSE : CONDITIONAL_WITH_ELSE;
 	conditional->condition = condition;
 	conditional->ifBlock = ifBlock;
 	conditional->elseBlock = elseBlock;
-
-	if(typeExpression(condition) != DATA_TYPE_BOOLEAN)
-		addError(sprintf(ERR_MSG, "Condition must be a boolean"));
+	conditional->line = currentLine(state);
 	return conditional;
 }
 
-ContractInstructions *ContractInstructionsGrammarAction(ContractInstructions *instructions, ContractInstruction *instruction) {
-	ContractInstructions *contractInstructions = calloc(1, sizeof(ContractInstructions));
-	contractInstructions->type = instructions == NULL ? CONTRACT_INSTRUCTIONS_EMPTY : CONTRACT_INSTRUCTIONS_MULTIPLE;
-	contractInstructions->instructions = instructions;
-	contractInstructions->instruction = instruction;
-	return contractInstructions;
+// Sin lista, crea una lista vacía; si no, agrega "instruction" al final de la lista.
+ContractInstructions *ContractInstructionsGrammarAction(CompilerState *state, ContractInstructions *instructions, ContractInstruction *instruction) {
+	if (instructions == NULL)
+		return newNode(state, sizeof(ContractInstructions), NODE_CONTRACT_INSTRUCTIONS);
+
+	instructions->instructions = growList(state, instructions->instructions, instructions->count, &instructions->capacity, sizeof(ContractInstruction *));
+	instructions->instructions[instructions->count++] = instruction;
+	return instructions;
 }
 
-ContractInstruction *StateVariableContractInstructionGrammarAction(Decorators *variableDecorators, VariableDefinition *variableDefinition) {
-	ContractInstruction *contractInstruction = calloc(1, sizeof(ContractInstruction));
+ContractInstruction *StateVariableContractInstructionGrammarAction(CompilerState *state, Decorators *variableDecorators, VariableDefinition *variableDefinition) {
+	ContractInstruction *contractInstruction = newNode(state, sizeof(ContractInstruction), NODE_CONTRACT_INSTRUCTION);
 	contractInstruction->type = STATE_VARIABLE_DECLARATION;
 	contractInstruction->variableDecorators = variableDecorators;
 	contractInstruction->variableDefinition = variableDefinition;
 	return contractInstruction;
 }
 
-ContractInstruction *FunctionDefinitionContractInstructionGrammarAction(FunctionDefinition *functionDefinition) {
-	ContractInstruction *contractInstruction = calloc(1, sizeof(ContractInstruction));
+ContractInstruction *FunctionDefinitionContractInstructionGrammarAction(CompilerState *state, FunctionDefinition *functionDefinition) {
+	ContractInstruction *contractInstruction = newNode(state, sizeof(ContractInstruction), NODE_CONTRACT_INSTRUCTION);
 	contractInstruction->type = FUNCTION_DECLARATION;
 	contractInstruction->functionDefinition = functionDefinition;
 	return contractInstruction;
 }
 
-ContractInstruction *EventDefinitionContractInstructionGrammarAction(char *eventIdentifier, ParameterDefinition *eventParams) {
-	if (symbolExists(eventIdentifier))
-		addError(sprintf(ERR_MSG, "`%s` already exists", eventIdentifier));
-	else
-		insertSymbol(eventIdentifier, DATA_TYPE_VOID, SYMBOL_TYPE_EVENT);
-	
-	// Remove parameters from symbol table
-	Parameters *params = eventParams->parameters;
-	while (params != NULL) {
-		removeSymbol(params->identifier);
-		params = params->parameters;
-	}
-
-	ContractInstruction *contractInstruction = calloc(1, sizeof(ContractInstruction));
+ContractInstruction *EventDefinitionContractInstructionGrammarAction(CompilerState *state, char *eventIdentifier, ParameterDefinition *eventParams) {
+	ContractInstruction *contractInstruction = newNode(state, sizeof(ContractInstruction), NODE_CONTRACT_INSTRUCTION);
 	contractInstruction->type = EVENT_DECLARATION;
 	contractInstruction->eventIdentifier = eventIdentifier;
 	contractInstruction->eventParams = eventParams;
+	contractInstruction->line = currentLine(state);
 	return contractInstruction;
 }
 
-FunctionInstructions *FunctionInstructionsGrammarAction(FunctionInstructions *instructions, FunctionInstruction *instruction) {
-	FunctionInstructions *functionInstructions = calloc(1, sizeof(FunctionInstructions));
-	functionInstructions->type = instructions == NULL ? FUNCTION_INSTRUCTIONS_EMPTY : FUNCTION_INSTRUCTIONS_MULTIPLE;
-	functionInstructions->instructions = instructions;
-	functionInstructions->instruction = instruction;
-	return functionInstructions;
+// Sin lista, crea una lista vacía; si no, agrega "instruction" al final de la lista.
+FunctionInstructions *FunctionInstructionsGrammarAction(CompilerState *state, FunctionInstructions *instructions, FunctionInstruction *instruction) {
+	if (instructions == NULL)
+		return newNode(state, sizeof(FunctionInstructions), NODE_FUNCTION_INSTRUCTIONS);
+
+	instructions->instructions = growList(state, instructions->instructions, instructions->count, &instructions->capacity, sizeof(FunctionInstruction *));
+	instructions->instructions[instructions->count++] = instruction;
+	return instructions;
 }
 
-FunctionInstruction *VariableDefinitionFunctionInstructionGrammarAction(VariableDefinition *variableDefinition) {
-	FunctionInstruction *functionInstruction = calloc(1, sizeof(FunctionInstruction));
+FunctionInstruction *VariableDefinitionFunctionInstructionGrammarAction(CompilerState *state, VariableDefinition *variableDefinition) {
+	FunctionInstruction *functionInstruction = newNode(state, sizeof(FunctionInstruction), NODE_FUNCTION_INSTRUCTION);
 	functionInstruction->type = FUNCTION_INSTRUCTION_VARIABLE_DEFINITION;
 	functionInstruction->variableDefinition = variableDefinition;
 	return functionInstruction;	
 }
 
-FunctionInstruction *ConditionalFunctionInstructionGrammarAction(Conditional *conditional) {
-	FunctionInstruction *functionInstruction = calloc(1, sizeof(FunctionInstruction));
+FunctionInstruction *ConditionalFunctionInstructionGrammarAction(CompilerState *state, Conditional *conditional) {
+	FunctionInstruction *functionInstruction = newNode(state, sizeof(FunctionInstruction), NODE_FUNCTION_INSTRUCTION);
 	functionInstruction->type = FUNCTION_INSTRUCTION_CONDITIONAL;
 	functionInstruction->conditional = conditional;
 	return functionInstruction;	
 }
 
-FunctionInstruction *FunctionCallFunctionInstructionGrammarAction(FunctionCall *functionCall) {
-	FunctionInstruction *functionInstruction = calloc(1, sizeof(FunctionInstruction));
+FunctionInstruction *FunctionCallFunctionInstructionGrammarAction(CompilerState *state, FunctionCall *functionCall) {
+	FunctionInstruction *functionInstruction = newNode(state, sizeof(FunctionInstruction), NODE_FUNCTION_INSTRUCTION);
 	functionInstruction->type = FUNCTION_INSTRUCTION_FUNCTION_CALL;
 	functionInstruction->functionCall = functionCall;
 	return functionInstruction;	
 }
 
-FunctionInstruction *MemberCallFunctionInstructionGrammarAction(MemberCall *memberCall) {
-	FunctionInstruction *functionInstruction = calloc(1, sizeof(FunctionInstruction));
+FunctionInstruction *MemberCallFunctionInstructionGrammarAction(CompilerState *state, MemberCall *memberCall) {
+	FunctionInstruction *functionInstruction = newNode(state, sizeof(FunctionInstruction), NODE_FUNCTION_INSTRUCTION);
 	functionInstruction->type = FUNCTION_INSTRUCTION_MEMBER_CALL;
 	functionInstruction->memberCall = memberCall;
 	return functionInstruction;	
 }
 
-FunctionInstruction *EmitEventFunctionInstructionGrammarAction(char *eventIdentifier, Arguments *eventArgs) {
-	if (!symbolExists(eventIdentifier))
-		addError(sprintf(ERR_MSG, "Error: undefined event `%s`", eventIdentifier));
-
-	FunctionInstruction *functionInstruction = calloc(1, sizeof(FunctionInstruction));
+FunctionInstruction *EmitEventFunctionInstructionGrammarAction(CompilerState *state, char *eventIdentifier, Arguments *eventArgs) {
+	FunctionInstruction *functionInstruction = newNode(state, sizeof(FunctionInstruction), NODE_FUNCTION_INSTRUCTION);
 	functionInstruction->type = FUNCTION_INSTRUCTION_EMIT_EVENT;
 	functionInstruction->eventIdentifier = eventIdentifier;
 	functionInstruction->eventArgs = eventArgs;
-
-	if(getSymbolType(eventIdentifier) != SYMBOL_TYPE_EVENT)
-		addError(sprintf(ERR_MSG, "%s is not an event", eventIdentifier));
+	functionInstruction->line = currentLine(state);
 	return functionInstruction;	
 }
 
-FunctionInstruction *AssignmentFunctionInstructionGrammarAction(Assignment *assignment) {
-	FunctionInstruction *functionInstruction = calloc(1, sizeof(FunctionInstruction));
+FunctionInstruction *AssignmentFunctionInstructionGrammarAction(CompilerState *state, Assignment *assignment) {
+	FunctionInstruction *functionInstruction = newNode(state, sizeof(FunctionInstruction), NODE_FUNCTION_INSTRUCTION);
 	functionInstruction->type = FUNCTION_INSTRUCTION_ASSIGNMENT;
 	functionInstruction->assignment = assignment;
 	return functionInstruction;	
 }
 
-FunctionInstruction *MathAssignmentFunctionInstructionGrammarAction(MathAssignment *mathAssignment) {
-	FunctionInstruction *functionInstruction = calloc(1, sizeof(FunctionInstruction));
+FunctionInstruction *MathAssignmentFunctionInstructionGrammarAction(CompilerState *state, MathAssignment *mathAssignment) {
+	FunctionInstruction *functionInstruction = newNode(state, sizeof(FunctionInstruction), NODE_FUNCTION_INSTRUCTION);
 	functionInstruction->type = FUNCTION_INSTRUCTION_MATH_ASSIGNMENT;
 	functionInstruction->mathAssignment = mathAssignment;
 	return functionInstruction;	
 }
 
-FunctionInstruction *LoopFunctionInstructionGrammarAction(Loop *loop) {
-	FunctionInstruction *functionInstruction = calloc(1, sizeof(FunctionInstruction));
+FunctionInstruction *LoopFunctionInstructionGrammarAction(CompilerState *state, Loop *loop) {
+	FunctionInstruction *functionInstruction = newNode(state, sizeof(FunctionInstruction), NODE_FUNCTION_INSTRUCTION);
 	functionInstruction->type = FUNCTION_INSTRUCTION_LOOP;
 	functionInstruction->loop = loop;
 	return functionInstruction;	
 }
 
-Loop *LoopGrammarAction(LoopInitialization *loopInitialization, LoopCondition *loopCondition, LoopIteration *loopIteration, FunctionBlock *functionBlock) {
-	Loop *loop = calloc(1, sizeof(Loop));
+Loop *LoopGrammarAction(CompilerState *state, LoopInitialization *loopInitialization, LoopCondition *loopCondition, LoopIteration *loopIteration, FunctionBlock *functionBlock) {
+	Loop *loop = newNode(state, sizeof(Loop), NODE_LOOP);
 	loop->loopInitialization = loopInitialization;
 	loop->loopCondition = loopCondition;
 	loop->loopIteration = loopIteration;
@@ -215,329 +205,267 @@ Loop *LoopGrammarAction(LoopInitialization *loopInitialization, LoopCondition *l
 	return loop;	
 }
 
-LoopInitialization *LoopInitVarDefGrammarAction(VariableDefinition *variable) {
-	LoopInitialization *loopInitialization = calloc(1, sizeof(LoopInitialization));
-	loopInitialization->type = LOOP_INITIALIZATION_VARIABLE_DEFINITION;
+LoopInitialization *LoopInitVarDefGrammarAction(CompilerState *state, VariableDefinition *variable) {
+	LoopInitialization *loopInitialization = newNode(state, sizeof(LoopInitialization), NODE_LOOP_INITIALIZATION);
+	loopInitialization->type = variable == NULL ? LOOP_INITIALIZATION_EMPTY : LOOP_INITIALIZATION_VARIABLE_DEFINITION;
 	loopInitialization->variable = variable;
 	return loopInitialization;
 }
 
-LoopInitialization *LoopInitAssignmentGrammarAction(Assignment *assignment) {
-	LoopInitialization *loopInitialization = calloc(1, sizeof(LoopInitialization));
+LoopInitialization *LoopInitAssignmentGrammarAction(CompilerState *state, Assignment *assignment) {
+	LoopInitialization *loopInitialization = newNode(state, sizeof(LoopInitialization), NODE_LOOP_INITIALIZATION);
 	loopInitialization->type = LOOP_INITIALIZATION_ASSIGNMENT;
 	loopInitialization->assignment = assignment;
 	return loopInitialization;
 }
 
-LoopInitialization *LoopInitMathAssignmentGrammarAction(MathAssignment *assignment) {
-	LoopInitialization *loopInitialization = calloc(1, sizeof(LoopInitialization));
+LoopInitialization *LoopInitMathAssignmentGrammarAction(CompilerState *state, MathAssignment *assignment) {
+	LoopInitialization *loopInitialization = newNode(state, sizeof(LoopInitialization), NODE_LOOP_INITIALIZATION);
 	loopInitialization->type = LOOP_INITIALIZATION_MATH_ASSIGNMENT;
 	loopInitialization->mathAssignment = assignment;
 	return loopInitialization;
 }
 
-LoopCondition *LoopConditionGrammarAction(Expression *condition) {
-	LoopCondition *loopCondition = calloc(1, sizeof(LoopCondition));
+LoopCondition *LoopConditionGrammarAction(CompilerState *state, Expression *condition) {
+	LoopCondition *loopCondition = newNode(state, sizeof(LoopCondition), NODE_LOOP_CONDITION);
 	loopCondition->type = condition == NULL ? LOOP_CONDITION_EMPTY : LOOP_CONDITION_CONDITIONAL;
 	loopCondition->condition = condition;
 	return loopCondition;
 }
 
-LoopIteration *LoopIterationAssignmentGrammarAction(Assignment *assignment) {
-	LoopIteration *loopIteration = calloc(1, sizeof(LoopIteration));
+LoopIteration *LoopIterationAssignmentGrammarAction(CompilerState *state, Assignment *assignment) {
+	LoopIteration *loopIteration = newNode(state, sizeof(LoopIteration), NODE_LOOP_ITERATION);
 	loopIteration->type = assignment == NULL ? LOOP_ITERATION_EMPTY : LOOP_ITERATION_ASSIGNMENT;
 	loopIteration->assignment = assignment;
 	return loopIteration;
 }
 
-LoopIteration *LoopIterationMathAssignmentGrammarAction(MathAssignment *mathAssignment) {
-	LoopIteration *loopIteration = calloc(1, sizeof(LoopIteration));
+LoopIteration *LoopIterationMathAssignmentGrammarAction(CompilerState *state, MathAssignment *mathAssignment) {
+	LoopIteration *loopIteration = newNode(state, sizeof(LoopIteration), NODE_LOOP_ITERATION);
 	loopIteration->type = LOOP_ITERATION_MATH_ASSIGNMENT;
 	loopIteration->mathAssignment = mathAssignment;
 	return loopIteration;
 }
 
-MathAssignment *IncDecGrammarAction(Assignable *variable, MathAssignmentType type) {
-	MathAssignment *mathAssignment = calloc(1, sizeof(MathAssignment));
+MathAssignment *IncDecGrammarAction(CompilerState *state, Assignable *variable, MathAssignmentType type) {
+	MathAssignment *mathAssignment = newNode(state, sizeof(MathAssignment), NODE_MATH_ASSIGNMENT);
 	mathAssignment->type = type;
 	mathAssignment->variable = variable;
-
-	if (typeMathAssignment(mathAssignment) == -1)
-		addError(sprintf(ERR_MSG, "Can not apply math operators to variable"));
+	mathAssignment->line = currentLine(state);
 	return mathAssignment;
 }
 
-Assignable *AssignableGrammarAction(char *identifier, Expression *arrayIndex) {
-	if (!symbolExists(identifier))
-		addError(sprintf(ERR_MSG, "Variable `%s` does not exist", identifier));
-
-	Assignable *assignable = calloc(1, sizeof(Assignable));
+Assignable *AssignableGrammarAction(CompilerState *state, char *identifier, Expression *arrayIndex) {
+	Assignable *assignable = newNode(state, sizeof(Assignable), NODE_ASSIGNABLE);
 	assignable->type = arrayIndex == NULL ? ASSIGNABLE_VARIABLE : ASSIGNABLE_ARRAY;
 	assignable->identifier = identifier;
 	assignable->arrayIndex = arrayIndex;
+	assignable->line = currentLine(state);
 	return assignable;
 }
 
-Assignment *AssignmentExpressionGrammarAction(Assignable *assignable, Expression *expression) {
-	Assignment *assignment = calloc(1, sizeof(Assignment));
+Assignment *AssignmentExpressionGrammarAction(CompilerState *state, Assignable *assignable, Expression *expression) {
+	Assignment *assignment = newNode(state, sizeof(Assignment), NODE_ASSIGNMENT);
 	assignment->type = ASSIGNMENT_EXPRESSION;
 	assignment->assignable = assignable;
 	assignment->expression = expression;
-
-	if (typeAssignment(assignment) == -1)
-		addError(sprintf(ERR_MSG, "Invalid assignment to variable"));
+	assignment->line = currentLine(state);
 	return assignment;
 }
 
-Assignment *AssignmentFunctionCallGrammarAction(Assignable *assignable, FunctionCall *functionCall) {
-	Assignment *assignment = calloc(1, sizeof(Assignment));
+Assignment *AssignmentFunctionCallGrammarAction(CompilerState *state, Assignable *assignable, FunctionCall *functionCall) {
+	Assignment *assignment = newNode(state, sizeof(Assignment), NODE_ASSIGNMENT);
 	assignment->type = ASSIGNMENT_FUNCTION_CALL;
 	assignment->assignable = assignable;
 	assignment->functionCall = functionCall;
+	assignment->line = currentLine(state);
 	return assignment;
 }
 
-MathAssignment *MathAssignmentGrammarAction(Assignable *variable, MathAssignmentOperator *operator, Expression *expression) {
-	MathAssignment *mathAssignment = calloc(1, sizeof(MathAssignment));
+MathAssignment *MathAssignmentGrammarAction(CompilerState *state, Assignable *variable, MathAssignmentOperator *operator, Expression *expression) {
+	MathAssignment *mathAssignment = newNode(state, sizeof(MathAssignment), NODE_MATH_ASSIGNMENT);
 	mathAssignment->type = MATH_ASSIGNMENT_OPERATOR;
 	mathAssignment->variable = variable;
 	mathAssignment->operator = operator;
 	mathAssignment->expression = expression;
-
-	if (typeMathAssignment(mathAssignment) == -1)
-		addError(sprintf(ERR_MSG, "Can not apply math operators to variable"));
-
+	mathAssignment->line = currentLine(state);
 	return mathAssignment;
 }
 
-MathAssignmentOperator *MathAssignmentOperatorGrammarAction(MathAssignmentOperatorType type) {
-	MathAssignmentOperator *mathAssignmentOperator = calloc(1, sizeof(MathAssignmentOperator));
+MathAssignmentOperator *MathAssignmentOperatorGrammarAction(CompilerState *state, MathAssignmentOperatorType type) {
+	MathAssignmentOperator *mathAssignmentOperator = newNode(state, sizeof(MathAssignmentOperator), NODE_MATH_ASSIGNMENT_OPERATOR);
 	mathAssignmentOperator->type = type;
 	return mathAssignmentOperator;
 }
 
-FunctionCall *FunctionCallGrammarAction(char *identifier, Arguments *arguments) {
-	if (!symbolExists(identifier) && !isBuiltInFunction(identifier))
-		addError(sprintf(ERR_MSG, "Function `%s` does not exist", identifier));
-
-	FunctionCall *functionCall = calloc(1, sizeof(FunctionCall));
-
-	if (isBuiltInFunction(identifier))
-		functionCall->type = getBuiltInType(identifier);
+FunctionCall *FunctionCallGrammarAction(CompilerState *state, char *identifier, Arguments *arguments) {
+	FunctionCall *functionCall = newNode(state, sizeof(FunctionCall), NODE_FUNCTION_CALL);
+	functionCall->builtIn = findBuiltIn(identifier);
+	if (functionCall->builtIn != NULL)
+		functionCall->type = functionCall->builtIn->type;
 	else
-		functionCall->type = arguments->type == ARGUMENTS_EMPTY ? FUNCTION_CALL_NO_ARGS : FUNCTION_CALL_WITH_ARGS;
+		functionCall->type = arguments->count == 0 ? FUNCTION_CALL_NO_ARGS : FUNCTION_CALL_WITH_ARGS;
 	
 	functionCall->identifier = identifier;
 	functionCall->arguments = arguments;
-
-	if (typeFunctionCall(functionCall) == -1)
-		addError(sprintf(ERR_MSG, "%s is not callable", identifier));
-
+	functionCall->line = currentLine(state);
 	return functionCall;
 }
 
-Arguments *ArgumentsGrammarAction(Arguments *arguments, Expression *expression) {
-	Arguments *args = calloc(1, sizeof(Arguments));
-	args->type = arguments == NULL ? ARGUMENTS_SINGLE : ARGUMENTS_MULTIPLE;
-	args->arguments = arguments;
-	args->expression = expression;
+// Agrega "expression" al final de "arguments" (o de una nueva lista, si es NULL).
+Arguments *ArgumentsGrammarAction(CompilerState *state, Arguments *arguments, Expression *expression) {
+	Arguments *args = arguments == NULL ? ArgumentsEmptyGrammarAction(state) : arguments;
+	args->expressions = growList(state, args->expressions, args->count, &args->capacity, sizeof(Expression *));
+	args->expressions[args->count++] = expression;
 	return args;
 }
 
-Arguments *ArgumentsEmptyGrammarAction() {
-	Arguments *args = calloc(1, sizeof(Arguments));
-	args->type = ARGUMENTS_EMPTY;
-	return args;
+Arguments *ArgumentsEmptyGrammarAction(CompilerState *state) {
+	return newNode(state, sizeof(Arguments), NODE_ARGUMENTS);
 }
 
-MemberCall *MemberCallGrammarAction(Assignable *instance, FunctionCall *method) {
-	MemberCall *memberCall = calloc(1, sizeof(MemberCall));
+MemberCall *MemberCallGrammarAction(CompilerState *state, Assignable *instance, FunctionCall *method) {
+	MemberCall *memberCall = newNode(state, sizeof(MemberCall), NODE_MEMBER_CALL);
 	memberCall->instance = instance;
 	memberCall->method = method;
-
-	if (typeMemberCall(memberCall) == -1) 
-		addError(sprintf(ERR_MSG, "Invalid function call"));
+	memberCall->line = currentLine(state);
 	return memberCall;
 }
 
-VariableDefinition *VariableDefExpressionGrammarAction(DataType *dataType, char *identifier, Expression *expression) {
-	if (symbolExists(identifier))
-		addError(sprintf(ERR_MSG, "`%s` already exists", identifier));
-	else {
-		insertSymbol(identifier, dataType->type, SYMBOL_TYPE_VARIABLE);
-	}
-
-	VariableDefinition *variableDefinition = calloc(1, sizeof(VariableDefinition));
+VariableDefinition *VariableDefExpressionGrammarAction(CompilerState *state, DataType *dataType, char *identifier, Expression *expression) {
+	VariableDefinition *variableDefinition = newNode(state, sizeof(VariableDefinition), NODE_VARIABLE_DEFINITION);
 	variableDefinition->type = VARIABLE_DEFINITION_INIT_EXPRESSION;
 	variableDefinition->dataType = dataType;
 	variableDefinition->identifier = identifier;
 	variableDefinition->expression = expression;
-
-	if (typeVariableDefinition(variableDefinition) == -1) 
-		addError(sprintf(ERR_MSG, "Invalid variable definition"));
-
+	variableDefinition->line = currentLine(state);
 	return variableDefinition;
 }
 
-VariableDefinition *VariableDefFunctionCallGrammarAction(DataType *dataType, char *identifier, FunctionCall *functionCall) {
-	if (symbolExists(identifier))
-		addError(sprintf(ERR_MSG, "`%s` already exists", identifier));
-	else
-		insertSymbol(identifier, dataType->type, SYMBOL_TYPE_VARIABLE);
-
-	VariableDefinition *variableDefinition = calloc(1, sizeof(VariableDefinition));
+VariableDefinition *VariableDefFunctionCallGrammarAction(CompilerState *state, DataType *dataType, char *identifier, FunctionCall *functionCall) {
+	VariableDefinition *variableDefinition = newNode(state, sizeof(VariableDefinition), NODE_VARIABLE_DEFINITION);
 	variableDefinition->type = VARIABLE_DEFINITION_INIT_FUNCTION_CALL;
 	variableDefinition->dataType = dataType;
 	variableDefinition->identifier = identifier;
 	variableDefinition->functionCall = functionCall;
+	variableDefinition->line = currentLine(state);
 	return variableDefinition;
 }
 
-VariableDefinition *VariableDefinitionGrammarAction(DataType *dataType, char *identifier) {
-	if (symbolExists(identifier))
-		addError(sprintf(ERR_MSG, "`%s` already exists", identifier));
-	else {
-		if (dataType->type == DATA_TYPE_ARRAY) {
-			DataType *realDataType = dataType;
-			while (realDataType->type == DATA_TYPE_ARRAY)
-				realDataType = realDataType->dataType;
-			insertSymbol(identifier, realDataType->type, SYMBOL_TYPE_ARRAY);
-		} else {
-			insertSymbol(identifier, dataType->type, SYMBOL_TYPE_VARIABLE);
-		}
-	}
-
-	VariableDefinition *variableDefinition = calloc(1, sizeof(VariableDefinition));
+VariableDefinition *VariableDefinitionGrammarAction(CompilerState *state, DataType *dataType, char *identifier) {
+	VariableDefinition *variableDefinition = newNode(state, sizeof(VariableDefinition), NODE_VARIABLE_DEFINITION);
 	variableDefinition->type = VARIABLE_DEFINITION_DECLARATION;
 	variableDefinition->dataType = dataType;
 	variableDefinition->identifier = identifier;
+	variableDefinition->line = currentLine(state);
 	return variableDefinition;
 }
 
-DataType *DataTypeSimpleGrammarAction(DataTypeType type) {
-	DataType *dataType = calloc(1, sizeof(DataType));
+DataType *DataTypeSimpleGrammarAction(CompilerState *state, DataTypeType type) {
+	DataType *dataType = newNode(state, sizeof(DataType), NODE_DATA_TYPE);
 	dataType->type = type;
 	return dataType;
 }
 
-DataType *DataTypeArrayGrammarAction(DataType *dataType, Expression *expression) {
-	DataType *arrayDataType = calloc(1, sizeof(DataType));	
+DataType *DataTypeArrayGrammarAction(CompilerState *state, DataType *dataType, Expression *expression) {
+	DataType *arrayDataType = newNode(state, sizeof(DataType), NODE_DATA_TYPE);	
 	arrayDataType->type = DATA_TYPE_ARRAY;
 	arrayDataType->dataType = dataType;
 	arrayDataType->expression = expression;
-
-	int typeExp = typeExpression(expression);
-	if (typeExp != DATA_TYPE_UINT) 
-		addError(sprintf(ERR_MSG, "Invalid array size in array initialization."));
+	arrayDataType->line = currentLine(state);
 	return arrayDataType;
 }
 
-FunctionDefinition *FunctionDefinitionGrammarAction(Decorators *dec, char *id, ParameterDefinition *pd, FunctionBlock *fb) {
-	if (symbolExists(id))
-		addError(sprintf(ERR_MSG, "`%s` already exists", id));
-	else if (isBuiltInFunction(id))
-		addError(sprintf(ERR_MSG, "Cannot redeclare built-in function `%s`", id));
-	else
-		// TODO: add support for function return types
-		insertSymbol(id, DATA_TYPE_VOID, SYMBOL_TYPE_FUNCTION);
-
-	FunctionDefinition *functionDefinition = calloc(1, sizeof(FunctionDefinition));
+FunctionDefinition *FunctionDefinitionGrammarAction(CompilerState *state, Decorators *dec, char *id, ParameterDefinition *pd, FunctionBlock *fb) {
+	FunctionDefinition *functionDefinition = newNode(state, sizeof(FunctionDefinition), NODE_FUNCTION_DEFINITION);
 	functionDefinition->decorators = dec;
 	functionDefinition->parameterDefinition = pd;
 	functionDefinition->identifier = id;
 	functionDefinition->functionBlock = fb;
+	functionDefinition->line = currentLine(state);
 	return functionDefinition;
 }
 
-Decorators *DecoratorsGrammarAction(char *decorator, Decorators *decorators) {
-	Decorators *dec = calloc(1, sizeof(Decorators));
+Decorators *DecoratorsGrammarAction(CompilerState *state, char *decorator, Decorators *decorators) {
+	Decorators *dec = newNode(state, sizeof(Decorators), NODE_DECORATORS);
 	dec->type = decorators == NULL ? DECORATORS_NO_DECORATORS : DECORATORS_WITH_DECORATORS;
 	dec->decorators = decorators;
 	dec->decorator = decorator;
 	return dec;
 }
 
-ParameterDefinition *ParameterDefinitionGrammarAction(Parameters *parameters) {
-	ParameterDefinition *params = calloc(1, sizeof(ParameterDefinition));
+ParameterDefinition *ParameterDefinitionGrammarAction(CompilerState *state, Parameters *parameters) {
+	ParameterDefinition *params = newNode(state, sizeof(ParameterDefinition), NODE_PARAMETER_DEFINITION);
 	params->type = parameters == NULL ? PARAMETERS_DEFINITION_NO_PARAMS : PARAMETERS_DEFINITION_WITH_PARAMS;
 	params->parameters = parameters;
 	return params;
 }
 
-Parameters *ParametersGrammarAction(Parameters *parameters, DataType *dataType, char *identifier) {
-	Parameters *params = calloc(1, sizeof(Parameters));
-
-	// Add parameter to symbol table
-	if (symbolExists(identifier))
-		addError(sprintf(ERR_MSG, "Parameter shadows existing identifier `%s`", identifier));
-	else {
-		if (dataType->type == DATA_TYPE_ARRAY) {
-			DataType *realDataType = dataType;
-			while (realDataType->type == DATA_TYPE_ARRAY)
-				realDataType = realDataType->dataType;
-
-			insertSymbol(identifier, realDataType->type, SYMBOL_TYPE_ARRAY);
-		} else {
-			insertSymbol(identifier, dataType->type, SYMBOL_TYPE_VARIABLE);
-		}
-	}
-
-	params->type = parameters == NULL ? PARAMETERS_SINGLE : PARAMETERS_MULTIPLE;
-	params->parameters = parameters;
-	params->dataType = dataType;
-	params->identifier = identifier;
+// Agrega un parámetro al final de "parameters" (o de una nueva lista, si es NULL).
+Parameters *ParametersGrammarAction(CompilerState *state, Parameters *parameters, DataType *dataType, char *identifier) {
+	Parameters *params = parameters == NULL ? newNode(state, sizeof(Parameters), NODE_PARAMETERS) : parameters;
+	params->parameters = growList(state, params->parameters, params->count, &params->capacity, sizeof(Parameter));
+	params->parameters[params->count].dataType = dataType;
+	params->parameters[params->count].identifier = identifier;
+	params->parameters[params->count].line = currentLine(state);
+	params->count++;
 	return params;
 }
 
-Expression *ExpressionGrammarAction(ExpressionType type, Expression *left, Expression *right) {
-	Expression *expression = calloc(1, sizeof(Expression));
+Expression *ExpressionGrammarAction(CompilerState *state, ExpressionType type, Expression *left, Expression *right) {
+	Expression *expression = newNode(state, sizeof(Expression), NODE_EXPRESSION);
 	expression->type = type;
 	expression->left = left;
 	expression->right = right;
-
-	if (typeExpression(expression) == -1)
-		addError(sprintf(ERR_MSG, "Operation between incompatible types"));
-
+	expression->line = currentLine(state);
 	return expression;
 }
 
-Expression *FactorExpressionGrammarAction(Factor *factor) {
-	Expression *expression = calloc(1, sizeof(Expression));
+Expression *FactorExpressionGrammarAction(CompilerState *state, Factor *factor) {
+	Expression *expression = newNode(state, sizeof(Expression), NODE_EXPRESSION);
 	expression->type = EXPRESSION_FACTOR;
 	expression->factor = factor;
+	expression->line = currentLine(state);
 	return expression;
 }
 
-Factor *ExpressionFactorGrammarAction(Expression *expression) {
-	Factor *factor = calloc(1, sizeof(Factor));
+Factor *ExpressionFactorGrammarAction(CompilerState *state, Expression *expression) {
+	Factor *factor = newNode(state, sizeof(Factor), NODE_FACTOR);
 	factor->type = FACTOR_EXPRESSION;
 	factor->expression = expression;
 	return factor;
 }
 
-Factor *ConstantFactorGrammarAction(Constant *constant) {
-	Factor *factor = calloc(1, sizeof(Factor));
+Factor *ConstantFactorGrammarAction(CompilerState *state, Constant *constant) {
+	Factor *factor = newNode(state, sizeof(Factor), NODE_FACTOR);
 	factor->type = FACTOR_CONSTANT;
 	factor->constant = constant;
 	return factor;
 }
 
-Constant *StringConstantGrammarAction(ConstantType type, char *str) {
-	Constant *constant = calloc(1, sizeof(Constant));
+Constant *StringConstantGrammarAction(CompilerState *state, ConstantType type, char *str) {
+	Constant *constant = newNode(state, sizeof(Constant), NODE_CONSTANT);
 	constant->type = type;
 	constant->string = str;
 	return constant;
 }
 
-Constant *IntegerConstantGrammarAction(ConstantType type, int value) {
-	Constant *constant = calloc(1, sizeof(Constant));
+Constant *IntegerConstantGrammarAction(CompilerState *state, ConstantType type, int value) {
+	Constant *constant = newNode(state, sizeof(Constant), NODE_CONSTANT);
 	constant->type = type;
 	constant->value = value;
 	return constant;
 }
 
-Constant *AssignableConstantGrammarAction(struct Assignable *variable) {
-	Constant *constant = calloc(1, sizeof(Constant));
+Constant *NumberConstantGrammarAction(CompilerState *state, ConstantType type, Number *number) {
+	Constant *constant = newNode(state, sizeof(Constant), NODE_CONSTANT);
+	constant->type = type;
+	constant->number = number;
+	return constant;
+}
+
+Constant *AssignableConstantGrammarAction(CompilerState *state, struct Assignable *variable) {
+	Constant *constant = newNode(state, sizeof(Constant), NODE_CONSTANT);
 	constant->type = CONSTANT_VARIABLE;
 	constant->variable = variable;
 	return constant;
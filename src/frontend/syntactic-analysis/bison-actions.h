@@ -11,79 +11,80 @@
  * abstracta (i.e., el AST).
  */
 
-Program *ProgramGrammarAction(ContractDefinition *contract);
+Program *ProgramGrammarAction(CompilerState *state, ContractDefinition *contract);
 
-ContractDefinition *ContractDefinitionGrammarAction(char *identifier, ContractBlock *block);
-ContractBlock *ContractBlockGrammarAction(ContractInstructions *instructions);
-FunctionBlock *FunctionBlockGrammarAction(FunctionInstructions *instructions);
-Conditional *ConditionalGrammarAction(Expression *condition, FunctionBlock *ifBlock, FunctionBlock *elseBlock);
-ContractInstructions *ContractInstructionsGrammarAction(ContractInstructions *instructions, ContractInstruction *instruction);
+ContractDefinition *ContractDefinitionGrammarAction(CompilerState *state, char *identifier, ContractBlock *block);
+ContractBlock *ContractBlockGrammarAction(CompilerState *state, ContractInstructions *instructions);
+FunctionBlock *FunctionBlockGrammarAction(CompilerState *state, FunctionInstructions *instructions);
+Conditional *ConditionalGrammarAction(CompilerState *state, Expression *condition, FunctionBlock *ifBlock, FunctionBlock *elseBlock);
+ContractInstructions *ContractInstructionsGrammarAction(CompilerState *state, ContractInstructions *instructions, ContractInstruction *instruction);
 
-ContractInstruction *StateVariableContractInstructionGrammarAction(Decorators *variableDecorators, VariableDefinition *variableDefinition);
-ContractInstruction *FunctionDefinitionContractInstructionGrammarAction(FunctionDefinition *functionDefinition);
-ContractInstruction *EventDefinitionContractInstructionGrammarAction(char *eventIdentifier, ParameterDefinition *eventParams);
+ContractInstruction *StateVariableContractInstructionGrammarAction(CompilerState *state, Decorators *variableDecorators, VariableDefinition *variableDefinition);
+ContractInstruction *FunctionDefinitionContractInstructionGrammarAction(CompilerState *state, FunctionDefinition *functionDefinition);
+ContractInstruction *EventDefinitionContractInstructionGrammarAction(CompilerState *state, char *eventIdentifier, ParameterDefinition *eventParams);
 
-FunctionInstructions *FunctionInstructionsGrammarAction(FunctionInstructions *instructions, FunctionInstruction *instruction);
+FunctionInstructions *FunctionInstructionsGrammarAction(CompilerState *state, FunctionInstructions *instructions, FunctionInstruction *instruction);
 
-FunctionInstruction *VariableDefinitionFunctionInstructionGrammarAction(VariableDefinition *variableDefinition);
-FunctionInstruction *ConditionalFunctionInstructionGrammarAction(Conditional *conditional);
-FunctionInstruction *FunctionCallFunctionInstructionGrammarAction(FunctionCall *functionCall);
-FunctionInstruction *MemberCallFunctionInstructionGrammarAction(MemberCall *memberCall);
-FunctionInstruction *EmitEventFunctionInstructionGrammarAction(char *eventIdentifier, Arguments *eventArgs);
-FunctionInstruction *AssignmentFunctionInstructionGrammarAction(Assignment *assignment);
-FunctionInstruction *MathAssignmentFunctionInstructionGrammarAction(MathAssignment *mathAssignment);
-FunctionInstruction *LoopFunctionInstructionGrammarAction(Loop *loop);
+FunctionInstruction *VariableDefinitionFunctionInstructionGrammarAction(CompilerState *state, VariableDefinition *variableDefinition);
+FunctionInstruction *ConditionalFunctionInstructionGrammarAction(CompilerState *state, Conditional *conditional);
+FunctionInstruction *FunctionCallFunctionInstructionGrammarAction(CompilerState *state, FunctionCall *functionCall);
+FunctionInstruction *MemberCallFunctionInstructionGrammarAction(CompilerState *state, MemberCall *memberCall);
+FunctionInstruction *EmitEventFunctionInstructionGrammarAction(CompilerState *state, char *eventIdentifier, Arguments *eventArgs);
+FunctionInstruction *AssignmentFunctionInstructionGrammarAction(CompilerState *state, Assignment *assignment);
+FunctionInstruction *MathAssignmentFunctionInstructionGrammarAction(CompilerState *state, MathAssignment *mathAssignment);
+FunctionInstruction *LoopFunctionInstructionGrammarAction(CompilerState *state, Loop *loop);
 
-Loop * LoopGrammarAction(LoopInitialization *loopInitialization, LoopCondition *loopCondition, LoopIteration *loopIteration, FunctionBlock *functionBlock);
+Loop * LoopGrammarAction(CompilerState *state, LoopInitialization *loopInitialization, LoopCondition *loopCondition, LoopIteration *loopIteration, FunctionBlock *functionBlock);
 
-LoopInitialization *LoopInitVarDefGrammarAction(VariableDefinition *variable);
-LoopInitialization *LoopInitAssignmentGrammarAction(Assignment *assignment);
-LoopInitialization *LoopInitMathAssignmentGrammarAction(MathAssignment *assignment);
+LoopInitialization *LoopInitVarDefGrammarAction(CompilerState *state, VariableDefinition *variable);
+LoopInitialization *LoopInitAssignmentGrammarAction(CompilerState *state, Assignment *assignment);
+LoopInitialization *LoopInitMathAssignmentGrammarAction(CompilerState *state, MathAssignment *assignment);
 
-LoopCondition *LoopConditionGrammarAction(Expression *expression);
+LoopCondition *LoopConditionGrammarAction(CompilerState *state, Expression *expression);
 
-LoopIteration *LoopIterationAssignmentGrammarAction(Assignment *assignment);
-LoopIteration *LoopIterationMathAssignmentGrammarAction(MathAssignment *mathAssignment);
+LoopIteration *LoopIterationAssignmentGrammarAction(CompilerState *state, Assignment *assignment);
+LoopIteration *LoopIterationMathAssignmentGrammarAction(CompilerState *state, MathAssignment *mathAssignment);
 
-Assignable *AssignableGrammarAction(char *identifier, Expression *arrayIndex);
+Assignable *AssignableGrammarAction(CompilerState *state, char *identifier, Expression *arrayIndex);
 
-Assignment *AssignmentExpressionGrammarAction(Assignable *assignable, Expression *expression);
-Assignment *AssignmentFunctionCallGrammarAction(Assignable *assignable, FunctionCall *functionCall);
+Assignment *AssignmentExpressionGrammarAction(CompilerState *state, Assignable *assignable, Expression *expression);
+Assignment *AssignmentFunctionCallGrammarAction(CompilerState *state, Assignable *assignable, FunctionCall *functionCall);
 
-MathAssignment *MathAssignmentGrammarAction(Assignable *variable, MathAssignmentOperator *operator, Expression *expression);
-MathAssignment *IncDecGrammarAction(Assignable *variable, MathAssignmentType type);
+MathAssignment *MathAssignmentGrammarAction(CompilerState *state, Assignable *variable, MathAssignmentOperator *operator, Expression *expression);
+MathAssignment *IncDecGrammarAction(CompilerState *state, Assignable *variable, MathAssignmentType type);
 
-MathAssignmentOperator *MathAssignmentOperatorGrammarAction(MathAssignmentOperatorType type);
+MathAssignmentOperator *MathAssignmentOperatorGrammarAction(CompilerState *state, MathAssignmentOperatorType type);
 
-FunctionCall *FunctionCallGrammarAction(char *identifier, Arguments *arguments);
+FunctionCall *FunctionCallGrammarAction(CompilerState *state, char *identifier, Arguments *arguments);
 
-Arguments *ArgumentsGrammarAction(Arguments *arguments, Expression *expression);
-Arguments *ArgumentsEmptyGrammarAction();
+Arguments *ArgumentsGrammarAction(CompilerState *state, Arguments *arguments, Expression *expression);
+Arguments *ArgumentsEmptyGrammarAction(CompilerState *state);
 
-MemberCall *MemberCallGrammarAction(Assignable *instance, FunctionCall *method);
+MemberCall *MemberCallGrammarAction(CompilerState *state, Assignable *instance, FunctionCall *method);
 
-VariableDefinition *VariableDefExpressionGrammarAction(DataType *dataType, char *identifier, Expression *expression);
-VariableDefinition *VariableDefFunctionCallGrammarAction(DataType *dataType, char *identifier, FunctionCall *functionCall);
-VariableDefinition *VariableDefinitionGrammarAction(DataType *dataType, char *identifier);
+VariableDefinition *VariableDefExpressionGrammarAction(CompilerState *state, DataType *dataType, char *identifier, Expression *expression);
+VariableDefinition *VariableDefFunctionCallGrammarAction(CompilerState *state, DataType *dataType, char *identifier, FunctionCall *functionCall);
+VariableDefinition *VariableDefinitionGrammarAction(CompilerState *state, DataType *dataType, char *identifier);
 
-DataType *DataTypeSimpleGrammarAction(DataTypeType dataTypeType);
-DataType *DataTypeArrayGrammarAction(DataType *dataType, Expression *expression);
+DataType *DataTypeSimpleGrammarAction(CompilerState *state, DataTypeType dataTypeType);
+DataType *DataTypeArrayGrammarAction(CompilerState *state, DataType *dataType, Expression *expression);
 
-FunctionDefinition *FunctionDefinitionGrammarAction(Decorators *dec, char *id, ParameterDefinition *pd, FunctionBlock *fb);
+FunctionDefinition *FunctionDefinitionGrammarAction(CompilerState *state, Decorators *dec, char *id, ParameterDefinition *pd, FunctionBlock *fb);
 
-Decorators *DecoratorsGrammarAction(char *decorator, Decorators *decorators);
+Decorators *DecoratorsGrammarAction(CompilerState *state, char *decorator, Decorators *decorators);
 
-ParameterDefinition *ParameterDefinitionGrammarAction(Parameters *parameters);
-Parameters *ParametersGrammarAction(Parameters *parameters, DataType *dataType, char *identifier);
+ParameterDefinition *ParameterDefinitionGrammarAction(CompilerState *state, Parameters *parameters);
+Parameters *ParametersGrammarAction(CompilerState *state, Parameters *parameters, DataType *dataType, char *identifier);
 
-Expression *ExpressionGrammarAction(ExpressionType type, Expression *leftExpression, Expression *rightExpression);
-Expression *FactorExpressionGrammarAction(Factor *factor);
+Expression *ExpressionGrammarAction(CompilerState *state, ExpressionType type, Expression *leftExpression, Expression *rightExpression);
+Expression *FactorExpressionGrammarAction(CompilerState *state, Factor *factor);
 
-Factor *ExpressionFactorGrammarAction(Expression *expression);
-Factor *ConstantFactorGrammarAction(Constant *constant);
+Factor *ExpressionFactorGrammarAction(CompilerState *state, Expression *expression);
+Factor *ConstantFactorGrammarAction(CompilerState *state, Constant *constant);
 
-Constant *StringConstantGrammarAction(ConstantType type, char *str);
-Constant *IntegerConstantGrammarAction(ConstantType type, int value);
-Constant *AssignableConstantGrammarAction(Assignable *variable);
+Constant *StringConstantGrammarAction(CompilerState *state, ConstantType type, char *str);
+Constant *IntegerConstantGrammarAction(CompilerState *state, ConstantType type, int value);
+Constant *NumberConstantGrammarAction(CompilerState *state, ConstantType type, Number *number);
+Constant *AssignableConstantGrammarAction(CompilerState *state, Assignable *variable);
 
 #endif
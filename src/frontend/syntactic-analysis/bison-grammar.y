@@ -4,6 +4,21 @@
 
 %}
 
+// Parser reentrante: no usa variables globales, el analizador léxico y el
+// estado de la compilación se reciben como parámetros de "yyparse".
+%define api.pure full
+%param {yyscan_t scanner}
+%parse-param {CompilerState *state}
+
+%code requires {
+	#include "../../backend/support/shared.h"
+}
+
+%code provides {
+	// Analizador léxico reentrante generado por Flex.
+	int yylex(YYSTYPE *semanticValue, yyscan_t scanner);
+}
+
 // Tipos de dato utilizados en las variables semánticas ($$, $1, $2, etc.).
 %union {
 	// No-terminales
@@ -41,6 +56,7 @@
 	token token;
 	int integer;
 	char *string;
+	Number *number;
 }
 
 // Un token que jamás debe ser usado en la gramática.
@@ -113,8 +129,8 @@
 %token <string> ADDRESS
 %token <integer> BOOLEAN
 %token <string> STRING
-%token <integer> INTEGER
-%token <string> SCIENTIFIC_NOTATION
+%token <number> INTEGER
+%token <number> SCIENTIFIC_NOTATION
 
 // Tipos de dato para los no-terminales generados desde Bison.
 %type <program> program
@@ -161,155 +177,155 @@
 
 %%
 
-program: contract_definition													{ $$ = ProgramGrammarAction($1); }
+program: contract_definition													{ $$ = ProgramGrammarAction(state, $1); }
 	;
 
-contract_definition: CONTRACT IDENTIFIER contract_block							{ $$ = ContractDefinitionGrammarAction($2, $3); }
+contract_definition: CONTRACT IDENTIFIER contract_block							{ $$ = ContractDefinitionGrammarAction(state, $2, $3); }
 	;
 
-contract_block: OPEN_CURLY_BRACKET contract_instructions CLOSE_CURLY_BRACKET 	{ $$ = ContractBlockGrammarAction($2); }
+contract_block: OPEN_CURLY_BRACKET contract_instructions CLOSE_CURLY_BRACKET 	{ $$ = ContractBlockGrammarAction(state, $2); }
 	;
 
-function_block: OPEN_CURLY_BRACKET function_instructions CLOSE_CURLY_BRACKET	{ $$ = FunctionBlockGrammarAction($2); }
+function_block: OPEN_CURLY_BRACKET function_instructions CLOSE_CURLY_BRACKET	{ $$ = FunctionBlockGrammarAction(state, $2); }
 	;
 
-conditional: IF OPEN_PARENTHESIS expression CLOSE_PARENTHESIS function_block	{ $$ = ConditionalGrammarAction($3, $5, NULL); }
+conditional: IF OPEN_PARENTHESIS expression CLOSE_PARENTHESIS function_block	{ $$ = ConditionalGrammarAction(state, $3, $5, NULL); }
 	| IF OPEN_PARENTHESIS expression CLOSE_PARENTHESIS function_block
-		ELSE function_block														{ $$ = ConditionalGrammarAction($3, $5, $7); }
+		ELSE function_block														{ $$ = ConditionalGrammarAction(state, $3, $5, $7); }
 	;
 
-contract_instructions: contract_instructions contract_instruction				{ $$ = ContractInstructionsGrammarAction($1, $2); } 
-	| %empty																	{ $$ = ContractInstructionsGrammarAction(NULL, NULL); }
+contract_instructions: contract_instructions contract_instruction				{ $$ = ContractInstructionsGrammarAction(state, $1, $2); } 
+	| %empty																	{ $$ = ContractInstructionsGrammarAction(state, NULL, NULL); }
 	;
 
-contract_instruction: decorators variable_definition SEMI						{ $$ = StateVariableContractInstructionGrammarAction($1, $2); }
-	| function_definition														{ $$ = FunctionDefinitionContractInstructionGrammarAction($1); }
-	| EVENT IDENTIFIER parameter_definition SEMI								{ $$ = EventDefinitionContractInstructionGrammarAction($2, $3); }
+contract_instruction: decorators variable_definition SEMI						{ $$ = StateVariableContractInstructionGrammarAction(state, $1, $2); }
+	| function_definition														{ $$ = FunctionDefinitionContractInstructionGrammarAction(state, $1); }
+	| EVENT IDENTIFIER parameter_definition SEMI								{ $$ = EventDefinitionContractInstructionGrammarAction(state, $2, $3); }
 	;
 
-function_instructions: function_instructions function_instruction				{ $$ = FunctionInstructionsGrammarAction($1, $2); }
-	| %empty																	{ $$ = FunctionInstructionsGrammarAction(NULL, NULL); }
+function_instructions: function_instructions function_instruction				{ $$ = FunctionInstructionsGrammarAction(state, $1, $2); }
+	| %empty																	{ $$ = FunctionInstructionsGrammarAction(state, NULL, NULL); }
 	;
 
-function_instruction: variable_definition SEMI									{ $$ = VariableDefinitionFunctionInstructionGrammarAction($1); }
-	| conditional																{ $$ = ConditionalFunctionInstructionGrammarAction($1); }
-	| function_call SEMI														{ $$ = FunctionCallFunctionInstructionGrammarAction($1); }
-	| member_call SEMI															{ $$ = MemberCallFunctionInstructionGrammarAction($1); }
-	| EMIT IDENTIFIER OPEN_PARENTHESIS arguments CLOSE_PARENTHESIS SEMI			{ $$ = EmitEventFunctionInstructionGrammarAction($2, $4); }
-	| assignment SEMI															{ $$ = AssignmentFunctionInstructionGrammarAction($1); }
-	| math_assignment SEMI														{ $$ = MathAssignmentFunctionInstructionGrammarAction($1); }
-	| loop																		{ $$ = LoopFunctionInstructionGrammarAction($1); }
+function_instruction: variable_definition SEMI									{ $$ = VariableDefinitionFunctionInstructionGrammarAction(state, $1); }
+	| conditional																{ $$ = ConditionalFunctionInstructionGrammarAction(state, $1); }
+	| function_call SEMI														{ $$ = FunctionCallFunctionInstructionGrammarAction(state, $1); }
+	| member_call SEMI															{ $$ = MemberCallFunctionInstructionGrammarAction(state, $1); }
+	| EMIT IDENTIFIER OPEN_PARENTHESIS arguments CLOSE_PARENTHESIS SEMI			{ $$ = EmitEventFunctionInstructionGrammarAction(state, $2, $4); }
+	| assignment SEMI															{ $$ = AssignmentFunctionInstructionGrammarAction(state, $1); }
+	| math_assignment SEMI														{ $$ = MathAssignmentFunctionInstructionGrammarAction(state, $1); }
+	| loop																		{ $$ = LoopFunctionInstructionGrammarAction(state, $1); }
 	;
 
 loop: FOR OPEN_PARENTHESIS loop_initialization SEMI loop_condition 
-		SEMI loop_iteration CLOSE_PARENTHESIS function_block					{ $$ = LoopGrammarAction($3, $5, $7, $9); }
+		SEMI loop_iteration CLOSE_PARENTHESIS function_block					{ $$ = LoopGrammarAction(state, $3, $5, $7, $9); }
 	;
 
-loop_initialization: variable_definition										{ $$ = LoopInitVarDefGrammarAction($1); }
-	| assignment																{ $$ = LoopInitAssignmentGrammarAction($1); }
-	| math_assignment															{ $$ = LoopInitMathAssignmentGrammarAction($1); }
-	| %empty																	{ $$ = LoopInitVarDefGrammarAction(NULL); }
+loop_initialization: variable_definition										{ $$ = LoopInitVarDefGrammarAction(state, $1); }
+	| assignment																{ $$ = LoopInitAssignmentGrammarAction(state, $1); }
+	| math_assignment															{ $$ = LoopInitMathAssignmentGrammarAction(state, $1); }
+	| %empty																	{ $$ = LoopInitVarDefGrammarAction(state, NULL); }
 	;
 
-loop_condition: expression														{ $$ = LoopConditionGrammarAction($1); }
-	| %empty																	{ $$ = LoopConditionGrammarAction(NULL); }
+loop_condition: expression														{ $$ = LoopConditionGrammarAction(state, $1); }
+	| %empty																	{ $$ = LoopConditionGrammarAction(state, NULL); }
 	;
 
-loop_iteration: assignment														{ $$ = LoopIterationAssignmentGrammarAction($1); }
-	| math_assignment															{ $$ = LoopIterationMathAssignmentGrammarAction($1); }
-	| %empty																	{ $$ = LoopIterationAssignmentGrammarAction(NULL); }
+loop_iteration: assignment														{ $$ = LoopIterationAssignmentGrammarAction(state, $1); }
+	| math_assignment															{ $$ = LoopIterationMathAssignmentGrammarAction(state, $1); }
+	| %empty																	{ $$ = LoopIterationAssignmentGrammarAction(state, NULL); }
 	;
 
-assignable: IDENTIFIER															{ $$ = AssignableGrammarAction($1, NULL); }
-	| IDENTIFIER OPEN_SQUARE_BRACKET expression CLOSE_SQUARE_BRACKET			{ $$ = AssignableGrammarAction($1, $3); }
+assignable: IDENTIFIER															{ $$ = AssignableGrammarAction(state, $1, NULL); }
+	| IDENTIFIER OPEN_SQUARE_BRACKET expression CLOSE_SQUARE_BRACKET			{ $$ = AssignableGrammarAction(state, $1, $3); }
 
-assignment: assignable EQ expression											{ $$ = AssignmentExpressionGrammarAction($1, $3); }
-	| assignable EQ function_call												{ $$ = AssignmentFunctionCallGrammarAction($1, $3); }
+assignment: assignable EQ expression											{ $$ = AssignmentExpressionGrammarAction(state, $1, $3); }
+	| assignable EQ function_call												{ $$ = AssignmentFunctionCallGrammarAction(state, $1, $3); }
 	;
 
-math_assignment: assignable math_assignment_operator expression					{ $$ = MathAssignmentGrammarAction($1, $2, $3); }
-	| assignable INC 															{ $$ = IncDecGrammarAction($1, MATH_ASSIGNMENT_INCREMENT); }
-	| assignable DEC															{ $$ = IncDecGrammarAction($1, MATH_ASSIGNMENT_DECREMENT); }
+math_assignment: assignable math_assignment_operator expression					{ $$ = MathAssignmentGrammarAction(state, $1, $2, $3); }
+	| assignable INC 															{ $$ = IncDecGrammarAction(state, $1, MATH_ASSIGNMENT_INCREMENT); }
+	| assignable DEC															{ $$ = IncDecGrammarAction(state, $1, MATH_ASSIGNMENT_DECREMENT); }
 	;
 
-math_assignment_operator: ADD_EQ												{ $$ = MathAssignmentOperatorGrammarAction(MATH_ASSIGNMENT_OP_ADD_EQUAL); }
-	| SUB_EQ																	{ $$ = MathAssignmentOperatorGrammarAction(MATH_ASSIGNMENT_OP_SUBTRACT_EQUAL); }
-	| MUL_EQ																	{ $$ = MathAssignmentOperatorGrammarAction(MATH_ASSIGNMENT_OP_MULTIPLY_EQUAL); }
-	| DIV_EQ																	{ $$ = MathAssignmentOperatorGrammarAction(MATH_ASSIGNMENT_OP_DIVIDE_EQUAL); }
-	| MOD_EQ																	{ $$ = MathAssignmentOperatorGrammarAction(MATH_ASSIGNMENT_OP_MODULO_EQUAL); }
+math_assignment_operator: ADD_EQ												{ $$ = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_ADD_EQUAL); }
+	| SUB_EQ																	{ $$ = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_SUBTRACT_EQUAL); }
+	| MUL_EQ																	{ $$ = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_MULTIPLY_EQUAL); }
+	| DIV_EQ																	{ $$ = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_DIVIDE_EQUAL); }
+	| MOD_EQ																	{ $$ = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_MODULO_EQUAL); }
 	;
 
-function_call: IDENTIFIER OPEN_PARENTHESIS arguments CLOSE_PARENTHESIS			{ $$ = FunctionCallGrammarAction($1, $3); }
+function_call: IDENTIFIER OPEN_PARENTHESIS arguments CLOSE_PARENTHESIS			{ $$ = FunctionCallGrammarAction(state, $1, $3); }
 	;
 
-arguments: arguments COMMA expression											{ $$ = ArgumentsGrammarAction($1, $3); }
-	| expression																{ $$ = ArgumentsGrammarAction(NULL, $1); }
-	| %empty																	{ $$ = ArgumentsEmptyGrammarAction(); }
+arguments: arguments COMMA expression											{ $$ = ArgumentsGrammarAction(state, $1, $3); }
+	| expression																{ $$ = ArgumentsGrammarAction(state, NULL, $1); }
+	| %empty																	{ $$ = ArgumentsEmptyGrammarAction(state); }
 	;
 
-member_call: assignable DOT function_call										{ $$ = MemberCallGrammarAction($1, $3); }
+member_call: assignable DOT function_call										{ $$ = MemberCallGrammarAction(state, $1, $3); }
 	;
 
-variable_definition: data_type IDENTIFIER										{ $$ = VariableDefinitionGrammarAction($1, $2); }
-	| data_type IDENTIFIER EQ expression										{ $$ = VariableDefExpressionGrammarAction($1, $2, $4); }
-	| data_type IDENTIFIER EQ function_call										{ $$ = VariableDefFunctionCallGrammarAction($1, $2, $4); }
+variable_definition: data_type IDENTIFIER										{ $$ = VariableDefinitionGrammarAction(state, $1, $2); }
+	| data_type IDENTIFIER EQ expression										{ $$ = VariableDefExpressionGrammarAction(state, $1, $2, $4); }
+	| data_type IDENTIFIER EQ function_call										{ $$ = VariableDefFunctionCallGrammarAction(state, $1, $2, $4); }
 	;
 
-data_type: T_ERC20																{ $$ = DataTypeSimpleGrammarAction(DATA_TYPE_ERC20); }
-	| T_ERC721																	{ $$ = DataTypeSimpleGrammarAction(DATA_TYPE_ERC721); }
-	| T_BYTES																	{ $$ = DataTypeSimpleGrammarAction(DATA_TYPE_BYTES); }
-	| T_STRING																	{ $$ = DataTypeSimpleGrammarAction(DATA_TYPE_STRING); }
-	| T_BOOLEAN																	{ $$ = DataTypeSimpleGrammarAction(DATA_TYPE_BOOLEAN); }
-	| T_ADDRESS																	{ $$ = DataTypeSimpleGrammarAction(DATA_TYPE_ADDRESS); }
-	| T_UINT																	{ $$ = DataTypeSimpleGrammarAction(DATA_TYPE_UINT); }
-	| T_INT																		{ $$ = DataTypeSimpleGrammarAction(DATA_TYPE_INT); }
-	| data_type OPEN_SQUARE_BRACKET expression CLOSE_SQUARE_BRACKET				{ $$ = DataTypeArrayGrammarAction($1, $3); }
+data_type: T_ERC20																{ $$ = DataTypeSimpleGrammarAction(state, DATA_TYPE_ERC20); }
+	| T_ERC721																	{ $$ = DataTypeSimpleGrammarAction(state, DATA_TYPE_ERC721); }
+	| T_BYTES																	{ $$ = DataTypeSimpleGrammarAction(state, DATA_TYPE_BYTES); }
+	| T_STRING																	{ $$ = DataTypeSimpleGrammarAction(state, DATA_TYPE_STRING); }
+	| T_BOOLEAN																	{ $$ = DataTypeSimpleGrammarAction(state, DATA_TYPE_BOOLEAN); }
+	| T_ADDRESS																	{ $$ = DataTypeSimpleGrammarAction(state, DATA_TYPE_ADDRESS); }
+	| T_UINT																	{ $$ = DataTypeSimpleGrammarAction(state, DATA_TYPE_UINT); }
+	| T_INT																		{ $$ = DataTypeSimpleGrammarAction(state, DATA_TYPE_INT); }
+	| data_type OPEN_SQUARE_BRACKET expression CLOSE_SQUARE_BRACKET				{ $$ = DataTypeArrayGrammarAction(state, $1, $3); }
 	;
 
 function_definition: decorators 
-		FUNCTION IDENTIFIER parameter_definition function_block					{ $$ = FunctionDefinitionGrammarAction($1, $3, $4, $5); }
+		FUNCTION IDENTIFIER parameter_definition function_block					{ $$ = FunctionDefinitionGrammarAction(state, $1, $3, $4, $5); }
 	;
 
-decorators: DECORATOR decorators												{ $$ = DecoratorsGrammarAction($1, $2); }
-	| %empty																	{ $$ = DecoratorsGrammarAction(NULL, NULL); }
+decorators: DECORATOR decorators												{ $$ = DecoratorsGrammarAction(state, $1, $2); }
+	| %empty																	{ $$ = DecoratorsGrammarAction(state, NULL, NULL); }
 	;
 
-parameter_definition: OPEN_PARENTHESIS CLOSE_PARENTHESIS						{ $$ = ParameterDefinitionGrammarAction(NULL); }
-	| OPEN_PARENTHESIS parameters CLOSE_PARENTHESIS								{ $$ = ParameterDefinitionGrammarAction($2); }
+parameter_definition: OPEN_PARENTHESIS CLOSE_PARENTHESIS						{ $$ = ParameterDefinitionGrammarAction(state, NULL); }
+	| OPEN_PARENTHESIS parameters CLOSE_PARENTHESIS								{ $$ = ParameterDefinitionGrammarAction(state, $2); }
 	;
 
-parameters: parameters COMMA data_type IDENTIFIER								{ $$ = ParametersGrammarAction($1, $3, $4); }
-	| data_type IDENTIFIER														{ $$ = ParametersGrammarAction(NULL, $1, $2); }
+parameters: parameters COMMA data_type IDENTIFIER								{ $$ = ParametersGrammarAction(state, $1, $3, $4); }
+	| data_type IDENTIFIER														{ $$ = ParametersGrammarAction(state, NULL, $1, $2); }
 	;
 
-expression: expression[left] ADD expression[right]								{ $$ = ExpressionGrammarAction(EXPRESSION_ADDITION, $left, $right); }
-	| expression[left] SUB expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_SUBTRACTION, $left, $right); }
-	| expression[left] MUL expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_MULTIPLICATION, $left, $right); }
-	| expression[left] DIV expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_DIVISION, $left, $right); }
-	| expression[left] MOD expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_MODULO, $left, $right); }
-	| expression[left] EXP expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_EXPONENTIATION, $left, $right); }
-	| expression[left] EQ_EQ expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_EQUALITY, $left, $right); }
-	| expression[left] NEQ expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_INEQUALITY, $left, $right); }
-	| expression[left] LT expression[right]										{ $$ = ExpressionGrammarAction(EXPRESSION_LESS_THAN, $left, $right); }
-	| expression[left] LTE expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_LESS_THAN_OR_EQUAL, $left, $right); }
-	| expression[left] GT expression[right]										{ $$ = ExpressionGrammarAction(EXPRESSION_GREATER_THAN, $left, $right); }
-	| expression[left] GTE expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_GREATER_THAN_OR_EQUAL, $left, $right); }
-	| expression[left] AND expression[right]									{ $$ = ExpressionGrammarAction(EXPRESSION_AND, $left, $right); }
-	| expression[left] OR expression[right]										{ $$ = ExpressionGrammarAction(EXPRESSION_OR, $left, $right); }
-	| NOT expression															{ $$ = ExpressionGrammarAction(EXPRESSION_NOT, NULL, $2); }
-	| factor																	{ $$ = FactorExpressionGrammarAction($1); }
+expression: expression[left] ADD expression[right]								{ $$ = ExpressionGrammarAction(state, EXPRESSION_ADDITION, $left, $right); }
+	| expression[left] SUB expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_SUBTRACTION, $left, $right); }
+	| expression[left] MUL expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_MULTIPLICATION, $left, $right); }
+	| expression[left] DIV expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_DIVISION, $left, $right); }
+	| expression[left] MOD expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_MODULO, $left, $right); }
+	| expression[left] EXP expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_EXPONENTIATION, $left, $right); }
+	| expression[left] EQ_EQ expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_EQUALITY, $left, $right); }
+	| expression[left] NEQ expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_INEQUALITY, $left, $right); }
+	| expression[left] LT expression[right]										{ $$ = ExpressionGrammarAction(state, EXPRESSION_LESS_THAN, $left, $right); }
+	| expression[left] LTE expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_LESS_THAN_OR_EQUAL, $left, $right); }
+	| expression[left] GT expression[right]										{ $$ = ExpressionGrammarAction(state, EXPRESSION_GREATER_THAN, $left, $right); }
+	| expression[left] GTE expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_GREATER_THAN_OR_EQUAL, $left, $right); }
+	| expression[left] AND expression[right]									{ $$ = ExpressionGrammarAction(state, EXPRESSION_AND, $left, $right); }
+	| expression[left] OR expression[right]										{ $$ = ExpressionGrammarAction(state, EXPRESSION_OR, $left, $right); }
+	| NOT expression															{ $$ = ExpressionGrammarAction(state, EXPRESSION_NOT, NULL, $2); }
+	| factor																	{ $$ = FactorExpressionGrammarAction(state, $1); }
 	;
 
-factor: OPEN_PARENTHESIS expression CLOSE_PARENTHESIS							{ $$ = ExpressionFactorGrammarAction($2); }
-	| constant																	{ $$ = ConstantFactorGrammarAction($1); }
+factor: OPEN_PARENTHESIS expression CLOSE_PARENTHESIS							{ $$ = ExpressionFactorGrammarAction(state, $2); }
+	| constant																	{ $$ = ConstantFactorGrammarAction(state, $1); }
 	;
 
-constant: INTEGER																{ $$ = IntegerConstantGrammarAction(CONSTANT_INTEGER, $1); }
-	| assignable																{ $$ = AssignableConstantGrammarAction($1); }
-	| ADDRESS																	{ $$ = StringConstantGrammarAction(CONSTANT_ADDRESS, $1); }
-	| BOOLEAN																	{ $$ = IntegerConstantGrammarAction(CONSTANT_BOOLEAN, $1); }
-	| STRING																	{ $$ = StringConstantGrammarAction(CONSTANT_STRING, $1); }
-	| SCIENTIFIC_NOTATION														{ $$ = StringConstantGrammarAction(CONSTANT_SCIENTIFIC_NOTATION, $1); }
+constant: INTEGER																{ $$ = NumberConstantGrammarAction(state, CONSTANT_INTEGER, $1); }
+	| assignable																{ $$ = AssignableConstantGrammarAction(state, $1); }
+	| ADDRESS																	{ $$ = StringConstantGrammarAction(state, CONSTANT_ADDRESS, $1); }
+	| BOOLEAN																	{ $$ = IntegerConstantGrammarAction(state, CONSTANT_BOOLEAN, $1); }
+	| STRING																	{ $$ = StringConstantGrammarAction(state, CONSTANT_STRING, $1); }
+	| SCIENTIFIC_NOTATION														{ $$ = NumberConstantGrammarAction(state, CONSTANT_SCIENTIFIC_NOTATION, $1); }
 	;
 
 %%
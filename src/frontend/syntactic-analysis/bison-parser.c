@@ -0,0 +1,2038 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 2
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "../src/frontend/syntactic-analysis/bison-grammar.y"
+
+
+#include "bison-actions.h"
+
+
+#line 77 "../src/frontend/syntactic-analysis/bison-parser.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "bison-parser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ERROR = 3,                      /* ERROR  */
+  YYSYMBOL_CONTRACT = 4,                   /* CONTRACT  */
+  YYSYMBOL_FUNCTION = 5,                   /* FUNCTION  */
+  YYSYMBOL_EVENT = 6,                      /* EVENT  */
+  YYSYMBOL_EMIT = 7,                       /* EMIT  */
+  YYSYMBOL_IDENTIFIER = 8,                 /* IDENTIFIER  */
+  YYSYMBOL_ADD = 9,                        /* ADD  */
+  YYSYMBOL_SUB = 10,                       /* SUB  */
+  YYSYMBOL_MUL = 11,                       /* MUL  */
+  YYSYMBOL_DIV = 12,                       /* DIV  */
+  YYSYMBOL_MOD = 13,                       /* MOD  */
+  YYSYMBOL_EXP = 14,                       /* EXP  */
+  YYSYMBOL_INC = 15,                       /* INC  */
+  YYSYMBOL_ADD_EQ = 16,                    /* ADD_EQ  */
+  YYSYMBOL_DEC = 17,                       /* DEC  */
+  YYSYMBOL_SUB_EQ = 18,                    /* SUB_EQ  */
+  YYSYMBOL_MUL_EQ = 19,                    /* MUL_EQ  */
+  YYSYMBOL_DIV_EQ = 20,                    /* DIV_EQ  */
+  YYSYMBOL_MOD_EQ = 21,                    /* MOD_EQ  */
+  YYSYMBOL_EQ_EQ = 22,                     /* EQ_EQ  */
+  YYSYMBOL_NEQ = 23,                       /* NEQ  */
+  YYSYMBOL_LT = 24,                        /* LT  */
+  YYSYMBOL_LTE = 25,                       /* LTE  */
+  YYSYMBOL_GT = 26,                        /* GT  */
+  YYSYMBOL_GTE = 27,                       /* GTE  */
+  YYSYMBOL_AND = 28,                       /* AND  */
+  YYSYMBOL_OR = 29,                        /* OR  */
+  YYSYMBOL_NOT = 30,                       /* NOT  */
+  YYSYMBOL_IF = 31,                        /* IF  */
+  YYSYMBOL_ELSE = 32,                      /* ELSE  */
+  YYSYMBOL_FOR = 33,                       /* FOR  */
+  YYSYMBOL_OPEN_CURLY_BRACKET = 34,        /* OPEN_CURLY_BRACKET  */
+  YYSYMBOL_CLOSE_CURLY_BRACKET = 35,       /* CLOSE_CURLY_BRACKET  */
+  YYSYMBOL_OPEN_PARENTHESIS = 36,          /* OPEN_PARENTHESIS  */
+  YYSYMBOL_CLOSE_PARENTHESIS = 37,         /* CLOSE_PARENTHESIS  */
+  YYSYMBOL_OPEN_SQUARE_BRACKET = 38,       /* OPEN_SQUARE_BRACKET  */
+  YYSYMBOL_CLOSE_SQUARE_BRACKET = 39,      /* CLOSE_SQUARE_BRACKET  */
+  YYSYMBOL_SEMI = 40,                      /* SEMI  */
+  YYSYMBOL_EQ = 41,                        /* EQ  */
+  YYSYMBOL_COMMA = 42,                     /* COMMA  */
+  YYSYMBOL_DOT = 43,                       /* DOT  */
+  YYSYMBOL_T_ERC20 = 44,                   /* T_ERC20  */
+  YYSYMBOL_T_ERC721 = 45,                  /* T_ERC721  */
+  YYSYMBOL_T_BYTES = 46,                   /* T_BYTES  */
+  YYSYMBOL_T_STRING = 47,                  /* T_STRING  */
+  YYSYMBOL_T_BOOLEAN = 48,                 /* T_BOOLEAN  */
+  YYSYMBOL_T_ADDRESS = 49,                 /* T_ADDRESS  */
+  YYSYMBOL_T_UINT = 50,                    /* T_UINT  */
+  YYSYMBOL_T_INT = 51,                     /* T_INT  */
+  YYSYMBOL_DECORATOR = 52,                 /* DECORATOR  */
+  YYSYMBOL_ADDRESS = 53,                   /* ADDRESS  */
+  YYSYMBOL_BOOLEAN = 54,                   /* BOOLEAN  */
+  YYSYMBOL_STRING = 55,                    /* STRING  */
+  YYSYMBOL_INTEGER = 56,                   /* INTEGER  */
+  YYSYMBOL_SCIENTIFIC_NOTATION = 57,       /* SCIENTIFIC_NOTATION  */
+  YYSYMBOL_YYACCEPT = 58,                  /* $accept  */
+  YYSYMBOL_program = 59,                   /* program  */
+  YYSYMBOL_contract_definition = 60,       /* contract_definition  */
+  YYSYMBOL_contract_block = 61,            /* contract_block  */
+  YYSYMBOL_function_block = 62,            /* function_block  */
+  YYSYMBOL_conditional = 63,               /* conditional  */
+  YYSYMBOL_contract_instructions = 64,     /* contract_instructions  */
+  YYSYMBOL_contract_instruction = 65,      /* contract_instruction  */
+  YYSYMBOL_function_instructions = 66,     /* function_instructions  */
+  YYSYMBOL_function_instruction = 67,      /* function_instruction  */
+  YYSYMBOL_loop = 68,                      /* loop  */
+  YYSYMBOL_loop_initialization = 69,       /* loop_initialization  */
+  YYSYMBOL_loop_condition = 70,            /* loop_condition  */
+  YYSYMBOL_loop_iteration = 71,            /* loop_iteration  */
+  YYSYMBOL_assignable = 72,                /* assignable  */
+  YYSYMBOL_assignment = 73,                /* assignment  */
+  YYSYMBOL_math_assignment = 74,           /* math_assignment  */
+  YYSYMBOL_math_assignment_operator = 75,  /* math_assignment_operator  */
+  YYSYMBOL_function_call = 76,             /* function_call  */
+  YYSYMBOL_arguments = 77,                 /* arguments  */
+  YYSYMBOL_member_call = 78,               /* member_call  */
+  YYSYMBOL_variable_definition = 79,       /* variable_definition  */
+  YYSYMBOL_data_type = 80,                 /* data_type  */
+  YYSYMBOL_function_definition = 81,       /* function_definition  */
+  YYSYMBOL_decorators = 82,                /* decorators  */
+  YYSYMBOL_parameter_definition = 83,      /* parameter_definition  */
+  YYSYMBOL_parameters = 84,                /* parameters  */
+  YYSYMBOL_expression = 85,                /* expression  */
+  YYSYMBOL_factor = 86,                    /* factor  */
+  YYSYMBOL_constant = 87                   /* constant  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  5
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   279
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  58
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  30
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  92
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  163
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   312
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   180,   180,   183,   186,   189,   192,   193,   197,   198,
+     201,   202,   203,   206,   207,   210,   211,   212,   213,   214,
+     215,   216,   217,   220,   224,   225,   226,   227,   230,   231,
+     234,   235,   236,   239,   240,   242,   243,   246,   247,   248,
+     251,   252,   253,   254,   255,   258,   261,   262,   263,   266,
+     269,   270,   271,   274,   275,   276,   277,   278,   279,   280,
+     281,   282,   285,   289,   290,   293,   294,   297,   298,   301,
+     302,   303,   304,   305,   306,   307,   308,   309,   310,   311,
+     312,   313,   314,   315,   316,   319,   320,   323,   324,   325,
+     326,   327,   328
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "ERROR", "CONTRACT",
+  "FUNCTION", "EVENT", "EMIT", "IDENTIFIER", "ADD", "SUB", "MUL", "DIV",
+  "MOD", "EXP", "INC", "ADD_EQ", "DEC", "SUB_EQ", "MUL_EQ", "DIV_EQ",
+  "MOD_EQ", "EQ_EQ", "NEQ", "LT", "LTE", "GT", "GTE", "AND", "OR", "NOT",
+  "IF", "ELSE", "FOR", "OPEN_CURLY_BRACKET", "CLOSE_CURLY_BRACKET",
+  "OPEN_PARENTHESIS", "CLOSE_PARENTHESIS", "OPEN_SQUARE_BRACKET",
+  "CLOSE_SQUARE_BRACKET", "SEMI", "EQ", "COMMA", "DOT", "T_ERC20",
+  "T_ERC721", "T_BYTES", "T_STRING", "T_BOOLEAN", "T_ADDRESS", "T_UINT",
+  "T_INT", "DECORATOR", "ADDRESS", "BOOLEAN", "STRING", "INTEGER",
+  "SCIENTIFIC_NOTATION", "$accept", "program", "contract_definition",
+  "contract_block", "function_block", "conditional",
+  "contract_instructions", "contract_instruction", "function_instructions",
+  "function_instruction", "loop", "loop_initialization", "loop_condition",
+  "loop_iteration", "assignable", "assignment", "math_assignment",
+  "math_assignment_operator", "function_call", "arguments", "member_call",
+  "variable_definition", "data_type", "function_definition", "decorators",
+  "parameter_definition", "parameters", "expression", "factor", "constant", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-145)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+      -1,     6,    66,  -145,    20,  -145,  -145,  -145,    16,    72,
+    -145,    31,  -145,  -145,    14,    36,  -145,    87,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,    92,    59,   228,    94,
+      36,  -145,    74,    -7,  -145,    61,   -24,  -145,    99,    49,
+      97,    -7,    -7,  -145,  -145,  -145,  -145,  -145,  -145,   116,
+    -145,  -145,  -145,  -145,   180,  -145,  -145,    54,  -145,   235,
+      -7,    64,   158,    -7,    -7,    -7,    -7,    -7,    -7,    -7,
+      -7,    -7,    -7,    -7,    -7,    -7,    -7,  -145,    93,    63,
+      -7,   137,  -145,    75,    75,    11,    11,   122,   122,   241,
+     241,   241,   241,   241,   241,    64,    64,  -145,   129,   117,
+     118,  -145,  -145,  -145,  -145,   194,   112,   133,   134,   135,
+     138,   -22,   235,  -145,   120,    -7,    73,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,    49,   149,    -7,  -145,  -145,  -145,
+    -145,  -145,  -145,    -7,    -7,   179,   139,   202,  -145,  -145,
+    -145,  -145,   235,   141,  -145,   235,   235,   -16,    99,    -7,
+     154,   126,   156,   235,  -145,    99,   189,  -145,   161,  -145,
+    -145,    99,  -145
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     2,     0,     1,     9,     3,    64,     0,
+       4,    64,     8,    11,     0,     0,    63,     0,    53,    54,
+      55,    56,    57,    58,    59,    60,     0,     0,     0,     0,
+       0,    10,    50,     0,    65,     0,     0,    12,     0,     0,
+      33,     0,     0,    89,    90,    91,    87,    92,    88,     0,
+      84,    86,    68,    66,     0,    14,    62,    33,    52,    51,
+       0,    83,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    61,     0,     0,
+      48,     0,    85,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    81,    82,    67,     0,     0,
+       0,     5,    16,    13,    22,     0,     0,     0,     0,     0,
+       0,     0,    47,    34,     0,     0,    27,    38,    40,    39,
+      41,    42,    43,    44,     0,     0,     0,    20,    21,    17,
+      18,    15,    45,     0,    48,     0,     0,     0,    25,    26,
+      24,    36,    35,     0,    49,    37,    46,     0,     0,    29,
+       0,     6,     0,    28,    19,     0,    32,     7,     0,    30,
+      31,     0,    23
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -145,  -145,  -145,  -145,  -144,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,   -72,  -111,  -104,  -145,   -69,    65,
+    -145,   -63,   -26,  -145,   221,   170,  -145,   -33,  -145,  -145
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     2,     3,     7,    56,   102,     8,    12,    79,   103,
+     104,   136,   152,   158,    48,   106,   107,   126,    58,   111,
+     109,    26,    27,    13,    14,    29,    36,   112,    50,    51
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_uint8 yytable[] =
+{
+      49,    40,    35,     1,   151,   138,    59,   105,    61,    62,
+     108,   157,   139,    53,     4,   132,   110,   162,    54,    17,
+     133,   150,     9,    41,    67,    68,   133,    81,    78,    42,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,   137,   159,    43,    44,    45,    46,
+      47,    10,   160,   140,     6,   141,   144,    57,    18,    19,
+      20,    21,    22,    23,    24,    25,     5,    32,    11,    52,
+      98,    57,    28,    63,    64,    65,    66,    67,    68,    41,
+      15,    40,   135,    11,   137,    42,    65,    66,    67,    68,
+      80,   142,    60,   145,    99,    30,   100,    33,   101,    33,
+     146,    97,    43,    44,    45,    46,    47,    18,    19,    20,
+      21,    22,    23,    24,    25,    39,   153,    18,    19,    20,
+      21,    22,    23,    24,    25,    63,    64,    65,    66,    67,
+      68,    33,    31,    55,    37,    60,    68,   114,    69,    70,
+      71,    72,    73,    74,    75,    76,    63,    64,    65,    66,
+      67,    68,   127,   115,   116,    77,   134,   143,   155,    69,
+      70,    71,    72,    73,    74,    75,    76,    63,    64,    65,
+      66,    67,    68,   128,   129,   130,   113,    80,   131,   149,
+      69,    70,    71,    72,    73,    74,    75,    76,    63,    64,
+      65,    66,    67,    68,   154,    82,   156,    40,   161,   147,
+      38,    69,    70,    71,    72,    73,    74,    75,    76,   117,
+     118,   119,   120,   121,   122,   123,   148,   117,   118,   119,
+     120,   121,   122,   123,    18,    19,    20,    21,    22,    23,
+      24,    25,    16,     0,     0,   124,     0,   125,     0,     0,
+       0,     0,     0,   124,    63,    64,    65,    66,    67,    68,
+      63,    64,    65,    66,    67,    68,     0,    69,    70,    71,
+      72,    73,    74,    75,    76,    34,     0,     0,     0,    75,
+      76,     0,    18,    19,    20,    21,    22,    23,    24,    25
+};
+
+static const yytype_int16 yycheck[] =
+{
+      33,     8,    28,     4,   148,   116,    39,    79,    41,    42,
+      79,   155,   116,    37,     8,    37,    79,   161,    42,     5,
+      42,    37,     6,    30,    13,    14,    42,    60,    54,    36,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,   116,   156,    53,    54,    55,    56,
+      57,    35,   156,   116,    34,   124,   125,     8,    44,    45,
+      46,    47,    48,    49,    50,    51,     0,     8,    52,     8,
+       7,     8,    36,     9,    10,    11,    12,    13,    14,    30,
+       8,     8,   115,    52,   156,    36,    11,    12,    13,    14,
+      36,   124,    38,   126,    31,     8,    33,    38,    35,    38,
+     133,     8,    53,    54,    55,    56,    57,    44,    45,    46,
+      47,    48,    49,    50,    51,    41,   149,    44,    45,    46,
+      47,    48,    49,    50,    51,     9,    10,    11,    12,    13,
+      14,    38,    40,    34,    40,    38,    14,     8,    22,    23,
+      24,    25,    26,    27,    28,    29,     9,    10,    11,    12,
+      13,    14,    40,    36,    36,    39,    36,     8,    32,    22,
+      23,    24,    25,    26,    27,    28,    29,     9,    10,    11,
+      12,    13,    14,    40,    40,    40,    39,    36,    40,    40,
+      22,    23,    24,    25,    26,    27,    28,    29,     9,    10,
+      11,    12,    13,    14,    40,    37,    40,     8,    37,   134,
+      30,    22,    23,    24,    25,    26,    27,    28,    29,    15,
+      16,    17,    18,    19,    20,    21,    37,    15,    16,    17,
+      18,    19,    20,    21,    44,    45,    46,    47,    48,    49,
+      50,    51,    11,    -1,    -1,    41,    -1,    43,    -1,    -1,
+      -1,    -1,    -1,    41,     9,    10,    11,    12,    13,    14,
+       9,    10,    11,    12,    13,    14,    -1,    22,    23,    24,
+      25,    26,    27,    28,    29,    37,    -1,    -1,    -1,    28,
+      29,    -1,    44,    45,    46,    47,    48,    49,    50,    51
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,     4,    59,    60,     8,     0,    34,    61,    64,     6,
+      35,    52,    65,    81,    82,     8,    82,     5,    44,    45,
+      46,    47,    48,    49,    50,    51,    79,    80,    36,    83,
+       8,    40,     8,    38,    37,    80,    84,    40,    83,    41,
+       8,    30,    36,    53,    54,    55,    56,    57,    72,    85,
+      86,    87,     8,    37,    42,    34,    62,     8,    76,    85,
+      38,    85,    85,     9,    10,    11,    12,    13,    14,    22,
+      23,    24,    25,    26,    27,    28,    29,    39,    80,    66,
+      36,    85,    37,    85,    85,    85,    85,    85,    85,    85,
+      85,    85,    85,    85,    85,    85,    85,     8,     7,    31,
+      33,    35,    63,    67,    68,    72,    73,    74,    76,    78,
+      79,    77,    85,    39,     8,    36,    36,    15,    16,    17,
+      18,    19,    20,    21,    41,    43,    75,    40,    40,    40,
+      40,    40,    37,    42,    36,    85,    69,    72,    73,    74,
+      79,    76,    85,     8,    76,    85,    85,    77,    37,    40,
+      37,    62,    70,    85,    40,    32,    40,    62,    71,    73,
+      74,    37,    62
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    58,    59,    60,    61,    62,    63,    63,    64,    64,
+      65,    65,    65,    66,    66,    67,    67,    67,    67,    67,
+      67,    67,    67,    68,    69,    69,    69,    69,    70,    70,
+      71,    71,    71,    72,    72,    73,    73,    74,    74,    74,
+      75,    75,    75,    75,    75,    76,    77,    77,    77,    78,
+      79,    79,    79,    80,    80,    80,    80,    80,    80,    80,
+      80,    80,    81,    82,    82,    83,    83,    84,    84,    85,
+      85,    85,    85,    85,    85,    85,    85,    85,    85,    85,
+      85,    85,    85,    85,    85,    86,    86,    87,    87,    87,
+      87,    87,    87
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     3,     3,     3,     5,     7,     2,     0,
+       3,     1,     4,     2,     0,     2,     1,     2,     2,     6,
+       2,     2,     1,     9,     1,     1,     1,     0,     1,     0,
+       1,     1,     0,     1,     4,     3,     3,     3,     2,     2,
+       1,     1,     1,     1,     1,     4,     3,     1,     0,     3,
+       2,     4,     4,     1,     1,     1,     1,     1,     1,     1,
+       1,     4,     5,     2,     0,     2,     3,     4,     2,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     2,     1,     3,     1,     1,     1,     1,
+       1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (scanner, state, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, scanner, state); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, CompilerState *state)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (scanner);
+  YY_USE (state);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, CompilerState *state)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner, state);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, yyscan_t scanner, CompilerState *state)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner, state);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner, state); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, yyscan_t scanner, CompilerState *state)
+{
+  YY_USE (yyvaluep);
+  YY_USE (scanner);
+  YY_USE (state);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (yyscan_t scanner, CompilerState *state)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, scanner);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* program: contract_definition  */
+#line 180 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                { (yyval.program) = ProgramGrammarAction(state, (yyvsp[0].contract_definition)); }
+#line 1301 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 3: /* contract_definition: CONTRACT IDENTIFIER contract_block  */
+#line 183 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                        { (yyval.contract_definition) = ContractDefinitionGrammarAction(state, (yyvsp[-1].string), (yyvsp[0].contract_block)); }
+#line 1307 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 4: /* contract_block: OPEN_CURLY_BRACKET contract_instructions CLOSE_CURLY_BRACKET  */
+#line 186 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                { (yyval.contract_block) = ContractBlockGrammarAction(state, (yyvsp[-1].contract_instructions)); }
+#line 1313 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 5: /* function_block: OPEN_CURLY_BRACKET function_instructions CLOSE_CURLY_BRACKET  */
+#line 189 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                { (yyval.function_block) = FunctionBlockGrammarAction(state, (yyvsp[-1].function_instructions)); }
+#line 1319 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 6: /* conditional: IF OPEN_PARENTHESIS expression CLOSE_PARENTHESIS function_block  */
+#line 192 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                { (yyval.conditional) = ConditionalGrammarAction(state, (yyvsp[-2].expression), (yyvsp[0].function_block), NULL); }
+#line 1325 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 7: /* conditional: IF OPEN_PARENTHESIS expression CLOSE_PARENTHESIS function_block ELSE function_block  */
+#line 194 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.conditional) = ConditionalGrammarAction(state, (yyvsp[-4].expression), (yyvsp[-2].function_block), (yyvsp[0].function_block)); }
+#line 1331 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 8: /* contract_instructions: contract_instructions contract_instruction  */
+#line 197 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                { (yyval.contract_instructions) = ContractInstructionsGrammarAction(state, (yyvsp[-1].contract_instructions), (yyvsp[0].contract_instruction)); }
+#line 1337 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 9: /* contract_instructions: %empty  */
+#line 198 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.contract_instructions) = ContractInstructionsGrammarAction(state, NULL, NULL); }
+#line 1343 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 10: /* contract_instruction: decorators variable_definition SEMI  */
+#line 201 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                        { (yyval.contract_instruction) = StateVariableContractInstructionGrammarAction(state, (yyvsp[-2].decorators), (yyvsp[-1].variable_definition)); }
+#line 1349 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 11: /* contract_instruction: function_definition  */
+#line 202 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                        { (yyval.contract_instruction) = FunctionDefinitionContractInstructionGrammarAction(state, (yyvsp[0].function_definition)); }
+#line 1355 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 12: /* contract_instruction: EVENT IDENTIFIER parameter_definition SEMI  */
+#line 203 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                { (yyval.contract_instruction) = EventDefinitionContractInstructionGrammarAction(state, (yyvsp[-2].string), (yyvsp[-1].parameter_definition)); }
+#line 1361 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 13: /* function_instructions: function_instructions function_instruction  */
+#line 206 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                { (yyval.function_instructions) = FunctionInstructionsGrammarAction(state, (yyvsp[-1].function_instructions), (yyvsp[0].function_instruction)); }
+#line 1367 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 14: /* function_instructions: %empty  */
+#line 207 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.function_instructions) = FunctionInstructionsGrammarAction(state, NULL, NULL); }
+#line 1373 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 15: /* function_instruction: variable_definition SEMI  */
+#line 210 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                { (yyval.function_instruction) = VariableDefinitionFunctionInstructionGrammarAction(state, (yyvsp[-1].variable_definition)); }
+#line 1379 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 16: /* function_instruction: conditional  */
+#line 211 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.function_instruction) = ConditionalFunctionInstructionGrammarAction(state, (yyvsp[0].conditional)); }
+#line 1385 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 17: /* function_instruction: function_call SEMI  */
+#line 212 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                        { (yyval.function_instruction) = FunctionCallFunctionInstructionGrammarAction(state, (yyvsp[-1].function_call)); }
+#line 1391 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 18: /* function_instruction: member_call SEMI  */
+#line 213 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.function_instruction) = MemberCallFunctionInstructionGrammarAction(state, (yyvsp[-1].member_call)); }
+#line 1397 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 19: /* function_instruction: EMIT IDENTIFIER OPEN_PARENTHESIS arguments CLOSE_PARENTHESIS SEMI  */
+#line 214 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                { (yyval.function_instruction) = EmitEventFunctionInstructionGrammarAction(state, (yyvsp[-4].string), (yyvsp[-2].arguments)); }
+#line 1403 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 20: /* function_instruction: assignment SEMI  */
+#line 215 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.function_instruction) = AssignmentFunctionInstructionGrammarAction(state, (yyvsp[-1].assignment)); }
+#line 1409 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 21: /* function_instruction: math_assignment SEMI  */
+#line 216 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                        { (yyval.function_instruction) = MathAssignmentFunctionInstructionGrammarAction(state, (yyvsp[-1].math_assignment)); }
+#line 1415 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 22: /* function_instruction: loop  */
+#line 217 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.function_instruction) = LoopFunctionInstructionGrammarAction(state, (yyvsp[0].loop)); }
+#line 1421 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 23: /* loop: FOR OPEN_PARENTHESIS loop_initialization SEMI loop_condition SEMI loop_iteration CLOSE_PARENTHESIS function_block  */
+#line 221 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                        { (yyval.loop) = LoopGrammarAction(state, (yyvsp[-6].loop_initialization), (yyvsp[-4].loop_condition), (yyvsp[-2].loop_iteration), (yyvsp[0].function_block)); }
+#line 1427 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 24: /* loop_initialization: variable_definition  */
+#line 224 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.loop_initialization) = LoopInitVarDefGrammarAction(state, (yyvsp[0].variable_definition)); }
+#line 1433 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 25: /* loop_initialization: assignment  */
+#line 225 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.loop_initialization) = LoopInitAssignmentGrammarAction(state, (yyvsp[0].assignment)); }
+#line 1439 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 26: /* loop_initialization: math_assignment  */
+#line 226 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.loop_initialization) = LoopInitMathAssignmentGrammarAction(state, (yyvsp[0].math_assignment)); }
+#line 1445 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 27: /* loop_initialization: %empty  */
+#line 227 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.loop_initialization) = LoopInitVarDefGrammarAction(state, NULL); }
+#line 1451 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 28: /* loop_condition: expression  */
+#line 230 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                        { (yyval.loop_condition) = LoopConditionGrammarAction(state, (yyvsp[0].expression)); }
+#line 1457 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 29: /* loop_condition: %empty  */
+#line 231 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.loop_condition) = LoopConditionGrammarAction(state, NULL); }
+#line 1463 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 30: /* loop_iteration: assignment  */
+#line 234 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                        { (yyval.loop_iteration) = LoopIterationAssignmentGrammarAction(state, (yyvsp[0].assignment)); }
+#line 1469 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 31: /* loop_iteration: math_assignment  */
+#line 235 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.loop_iteration) = LoopIterationMathAssignmentGrammarAction(state, (yyvsp[0].math_assignment)); }
+#line 1475 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 32: /* loop_iteration: %empty  */
+#line 236 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.loop_iteration) = LoopIterationAssignmentGrammarAction(state, NULL); }
+#line 1481 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 33: /* assignable: IDENTIFIER  */
+#line 239 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                        { (yyval.assignable) = AssignableGrammarAction(state, (yyvsp[0].string), NULL); }
+#line 1487 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 34: /* assignable: IDENTIFIER OPEN_SQUARE_BRACKET expression CLOSE_SQUARE_BRACKET  */
+#line 240 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                { (yyval.assignable) = AssignableGrammarAction(state, (yyvsp[-3].string), (yyvsp[-1].expression)); }
+#line 1493 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 35: /* assignment: assignable EQ expression  */
+#line 242 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.assignment) = AssignmentExpressionGrammarAction(state, (yyvsp[-2].assignable), (yyvsp[0].expression)); }
+#line 1499 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 36: /* assignment: assignable EQ function_call  */
+#line 243 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                { (yyval.assignment) = AssignmentFunctionCallGrammarAction(state, (yyvsp[-2].assignable), (yyvsp[0].function_call)); }
+#line 1505 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 37: /* math_assignment: assignable math_assignment_operator expression  */
+#line 246 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                { (yyval.math_assignment) = MathAssignmentGrammarAction(state, (yyvsp[-2].assignable), (yyvsp[-1].math_assignment_operator), (yyvsp[0].expression)); }
+#line 1511 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 38: /* math_assignment: assignable INC  */
+#line 247 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.math_assignment) = IncDecGrammarAction(state, (yyvsp[-1].assignable), MATH_ASSIGNMENT_INCREMENT); }
+#line 1517 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 39: /* math_assignment: assignable DEC  */
+#line 248 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.math_assignment) = IncDecGrammarAction(state, (yyvsp[-1].assignable), MATH_ASSIGNMENT_DECREMENT); }
+#line 1523 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 40: /* math_assignment_operator: ADD_EQ  */
+#line 251 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                { (yyval.math_assignment_operator) = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_ADD_EQUAL); }
+#line 1529 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 41: /* math_assignment_operator: SUB_EQ  */
+#line 252 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.math_assignment_operator) = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_SUBTRACT_EQUAL); }
+#line 1535 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 42: /* math_assignment_operator: MUL_EQ  */
+#line 253 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.math_assignment_operator) = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_MULTIPLY_EQUAL); }
+#line 1541 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 43: /* math_assignment_operator: DIV_EQ  */
+#line 254 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.math_assignment_operator) = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_DIVIDE_EQUAL); }
+#line 1547 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 44: /* math_assignment_operator: MOD_EQ  */
+#line 255 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.math_assignment_operator) = MathAssignmentOperatorGrammarAction(state, MATH_ASSIGNMENT_OP_MODULO_EQUAL); }
+#line 1553 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 45: /* function_call: IDENTIFIER OPEN_PARENTHESIS arguments CLOSE_PARENTHESIS  */
+#line 258 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                        { (yyval.function_call) = FunctionCallGrammarAction(state, (yyvsp[-3].string), (yyvsp[-1].arguments)); }
+#line 1559 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 46: /* arguments: arguments COMMA expression  */
+#line 261 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.arguments) = ArgumentsGrammarAction(state, (yyvsp[-2].arguments), (yyvsp[0].expression)); }
+#line 1565 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 47: /* arguments: expression  */
+#line 262 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.arguments) = ArgumentsGrammarAction(state, NULL, (yyvsp[0].expression)); }
+#line 1571 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 48: /* arguments: %empty  */
+#line 263 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.arguments) = ArgumentsEmptyGrammarAction(state); }
+#line 1577 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 49: /* member_call: assignable DOT function_call  */
+#line 266 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.member_call) = MemberCallGrammarAction(state, (yyvsp[-2].assignable), (yyvsp[0].function_call)); }
+#line 1583 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 50: /* variable_definition: data_type IDENTIFIER  */
+#line 269 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.variable_definition) = VariableDefinitionGrammarAction(state, (yyvsp[-1].data_type), (yyvsp[0].string)); }
+#line 1589 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 51: /* variable_definition: data_type IDENTIFIER EQ expression  */
+#line 270 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.variable_definition) = VariableDefExpressionGrammarAction(state, (yyvsp[-3].data_type), (yyvsp[-2].string), (yyvsp[0].expression)); }
+#line 1595 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 52: /* variable_definition: data_type IDENTIFIER EQ function_call  */
+#line 271 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.variable_definition) = VariableDefFunctionCallGrammarAction(state, (yyvsp[-3].data_type), (yyvsp[-2].string), (yyvsp[0].function_call)); }
+#line 1601 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 53: /* data_type: T_ERC20  */
+#line 274 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.data_type) = DataTypeSimpleGrammarAction(state, DATA_TYPE_ERC20); }
+#line 1607 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 54: /* data_type: T_ERC721  */
+#line 275 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.data_type) = DataTypeSimpleGrammarAction(state, DATA_TYPE_ERC721); }
+#line 1613 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 55: /* data_type: T_BYTES  */
+#line 276 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.data_type) = DataTypeSimpleGrammarAction(state, DATA_TYPE_BYTES); }
+#line 1619 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 56: /* data_type: T_STRING  */
+#line 277 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.data_type) = DataTypeSimpleGrammarAction(state, DATA_TYPE_STRING); }
+#line 1625 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 57: /* data_type: T_BOOLEAN  */
+#line 278 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.data_type) = DataTypeSimpleGrammarAction(state, DATA_TYPE_BOOLEAN); }
+#line 1631 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 58: /* data_type: T_ADDRESS  */
+#line 279 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.data_type) = DataTypeSimpleGrammarAction(state, DATA_TYPE_ADDRESS); }
+#line 1637 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 59: /* data_type: T_UINT  */
+#line 280 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.data_type) = DataTypeSimpleGrammarAction(state, DATA_TYPE_UINT); }
+#line 1643 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 60: /* data_type: T_INT  */
+#line 281 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.data_type) = DataTypeSimpleGrammarAction(state, DATA_TYPE_INT); }
+#line 1649 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 61: /* data_type: data_type OPEN_SQUARE_BRACKET expression CLOSE_SQUARE_BRACKET  */
+#line 282 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                { (yyval.data_type) = DataTypeArrayGrammarAction(state, (yyvsp[-3].data_type), (yyvsp[-1].expression)); }
+#line 1655 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 62: /* function_definition: decorators FUNCTION IDENTIFIER parameter_definition function_block  */
+#line 286 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                        { (yyval.function_definition) = FunctionDefinitionGrammarAction(state, (yyvsp[-4].decorators), (yyvsp[-2].string), (yyvsp[-1].parameter_definition), (yyvsp[0].function_block)); }
+#line 1661 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 63: /* decorators: DECORATOR decorators  */
+#line 289 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                { (yyval.decorators) = DecoratorsGrammarAction(state, (yyvsp[-1].string), (yyvsp[0].decorators)); }
+#line 1667 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 64: /* decorators: %empty  */
+#line 290 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.decorators) = DecoratorsGrammarAction(state, NULL, NULL); }
+#line 1673 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 65: /* parameter_definition: OPEN_PARENTHESIS CLOSE_PARENTHESIS  */
+#line 293 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                        { (yyval.parameter_definition) = ParameterDefinitionGrammarAction(state, NULL); }
+#line 1679 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 66: /* parameter_definition: OPEN_PARENTHESIS parameters CLOSE_PARENTHESIS  */
+#line 294 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                { (yyval.parameter_definition) = ParameterDefinitionGrammarAction(state, (yyvsp[-1].parameters)); }
+#line 1685 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 67: /* parameters: parameters COMMA data_type IDENTIFIER  */
+#line 297 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                { (yyval.parameters) = ParametersGrammarAction(state, (yyvsp[-3].parameters), (yyvsp[-1].data_type), (yyvsp[0].string)); }
+#line 1691 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 68: /* parameters: data_type IDENTIFIER  */
+#line 298 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                        { (yyval.parameters) = ParametersGrammarAction(state, NULL, (yyvsp[-1].data_type), (yyvsp[0].string)); }
+#line 1697 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 69: /* expression: expression ADD expression  */
+#line 301 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_ADDITION, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1703 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 70: /* expression: expression SUB expression  */
+#line 302 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_SUBTRACTION, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1709 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 71: /* expression: expression MUL expression  */
+#line 303 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_MULTIPLICATION, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1715 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 72: /* expression: expression DIV expression  */
+#line 304 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_DIVISION, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1721 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 73: /* expression: expression MOD expression  */
+#line 305 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_MODULO, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1727 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 74: /* expression: expression EXP expression  */
+#line 306 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_EXPONENTIATION, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1733 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 75: /* expression: expression EQ_EQ expression  */
+#line 307 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_EQUALITY, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1739 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 76: /* expression: expression NEQ expression  */
+#line 308 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_INEQUALITY, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1745 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 77: /* expression: expression LT expression  */
+#line 309 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_LESS_THAN, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1751 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 78: /* expression: expression LTE expression  */
+#line 310 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_LESS_THAN_OR_EQUAL, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1757 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 79: /* expression: expression GT expression  */
+#line 311 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_GREATER_THAN, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1763 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 80: /* expression: expression GTE expression  */
+#line 312 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_GREATER_THAN_OR_EQUAL, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1769 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 81: /* expression: expression AND expression  */
+#line 313 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_AND, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1775 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 82: /* expression: expression OR expression  */
+#line 314 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                        { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_OR, (yyvsp[-2].expression), (yyvsp[0].expression)); }
+#line 1781 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 83: /* expression: NOT expression  */
+#line 315 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.expression) = ExpressionGrammarAction(state, EXPRESSION_NOT, NULL, (yyvsp[0].expression)); }
+#line 1787 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 84: /* expression: factor  */
+#line 316 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.expression) = FactorExpressionGrammarAction(state, (yyvsp[0].factor)); }
+#line 1793 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 85: /* factor: OPEN_PARENTHESIS expression CLOSE_PARENTHESIS  */
+#line 319 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                        { (yyval.factor) = ExpressionFactorGrammarAction(state, (yyvsp[-1].expression)); }
+#line 1799 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 86: /* factor: constant  */
+#line 320 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.factor) = ConstantFactorGrammarAction(state, (yyvsp[0].constant)); }
+#line 1805 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 87: /* constant: INTEGER  */
+#line 323 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.constant) = NumberConstantGrammarAction(state, CONSTANT_INTEGER, (yyvsp[0].number)); }
+#line 1811 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 88: /* constant: assignable  */
+#line 324 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                { (yyval.constant) = AssignableConstantGrammarAction(state, (yyvsp[0].assignable)); }
+#line 1817 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 89: /* constant: ADDRESS  */
+#line 325 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.constant) = StringConstantGrammarAction(state, CONSTANT_ADDRESS, (yyvsp[0].string)); }
+#line 1823 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 90: /* constant: BOOLEAN  */
+#line 326 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.constant) = IntegerConstantGrammarAction(state, CONSTANT_BOOLEAN, (yyvsp[0].integer)); }
+#line 1829 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 91: /* constant: STRING  */
+#line 327 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                                        { (yyval.constant) = StringConstantGrammarAction(state, CONSTANT_STRING, (yyvsp[0].string)); }
+#line 1835 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+  case 92: /* constant: SCIENTIFIC_NOTATION  */
+#line 328 "../src/frontend/syntactic-analysis/bison-grammar.y"
+                                                                                                                                        { (yyval.constant) = NumberConstantGrammarAction(state, CONSTANT_SCIENTIFIC_NOTATION, (yyvsp[0].number)); }
+#line 1841 "../src/frontend/syntactic-analysis/bison-parser.c"
+    break;
+
+
+#line 1845 "../src/frontend/syntactic-analysis/bison-parser.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (scanner, state, YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, scanner, state);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner, state);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (scanner, state, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, scanner, state);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner, state);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 331 "../src/frontend/syntactic-analysis/bison-grammar.y"
+
@@ -0,0 +1,186 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_SRC_FRONTEND_SYNTACTIC_ANALYSIS_BISON_PARSER_H_INCLUDED
+# define YY_YY_SRC_FRONTEND_SYNTACTIC_ANALYSIS_BISON_PARSER_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+/* "%code requires" blocks.  */
+#line 13 "../src/frontend/syntactic-analysis/bison-grammar.y"
+
+	#include "../../backend/support/shared.h"
+
+#line 53 "../src/frontend/syntactic-analysis/bison-parser.h"
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ERROR = 258,                   /* ERROR  */
+    CONTRACT = 259,                /* CONTRACT  */
+    FUNCTION = 260,                /* FUNCTION  */
+    EVENT = 261,                   /* EVENT  */
+    EMIT = 262,                    /* EMIT  */
+    IDENTIFIER = 263,              /* IDENTIFIER  */
+    ADD = 264,                     /* ADD  */
+    SUB = 265,                     /* SUB  */
+    MUL = 266,                     /* MUL  */
+    DIV = 267,                     /* DIV  */
+    MOD = 268,                     /* MOD  */
+    EXP = 269,                     /* EXP  */
+    INC = 270,                     /* INC  */
+    ADD_EQ = 271,                  /* ADD_EQ  */
+    DEC = 272,                     /* DEC  */
+    SUB_EQ = 273,                  /* SUB_EQ  */
+    MUL_EQ = 274,                  /* MUL_EQ  */
+    DIV_EQ = 275,                  /* DIV_EQ  */
+    MOD_EQ = 276,                  /* MOD_EQ  */
+    EQ_EQ = 277,                   /* EQ_EQ  */
+    NEQ = 278,                     /* NEQ  */
+    LT = 279,                      /* LT  */
+    LTE = 280,                     /* LTE  */
+    GT = 281,                      /* GT  */
+    GTE = 282,                     /* GTE  */
+    AND = 283,                     /* AND  */
+    OR = 284,                      /* OR  */
+    NOT = 285,                     /* NOT  */
+    IF = 286,                      /* IF  */
+    ELSE = 287,                    /* ELSE  */
+    FOR = 288,                     /* FOR  */
+    OPEN_CURLY_BRACKET = 289,      /* OPEN_CURLY_BRACKET  */
+    CLOSE_CURLY_BRACKET = 290,     /* CLOSE_CURLY_BRACKET  */
+    OPEN_PARENTHESIS = 291,        /* OPEN_PARENTHESIS  */
+    CLOSE_PARENTHESIS = 292,       /* CLOSE_PARENTHESIS  */
+    OPEN_SQUARE_BRACKET = 293,     /* OPEN_SQUARE_BRACKET  */
+    CLOSE_SQUARE_BRACKET = 294,    /* CLOSE_SQUARE_BRACKET  */
+    SEMI = 295,                    /* SEMI  */
+    EQ = 296,                      /* EQ  */
+    COMMA = 297,                   /* COMMA  */
+    DOT = 298,                     /* DOT  */
+    T_ERC20 = 299,                 /* T_ERC20  */
+    T_ERC721 = 300,                /* T_ERC721  */
+    T_BYTES = 301,                 /* T_BYTES  */
+    T_STRING = 302,                /* T_STRING  */
+    T_BOOLEAN = 303,               /* T_BOOLEAN  */
+    T_ADDRESS = 304,               /* T_ADDRESS  */
+    T_UINT = 305,                  /* T_UINT  */
+    T_INT = 306,                   /* T_INT  */
+    DECORATOR = 307,               /* DECORATOR  */
+    ADDRESS = 308,                 /* ADDRESS  */
+    BOOLEAN = 309,                 /* BOOLEAN  */
+    STRING = 310,                  /* STRING  */
+    INTEGER = 311,                 /* INTEGER  */
+    SCIENTIFIC_NOTATION = 312      /* SCIENTIFIC_NOTATION  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 23 "../src/frontend/syntactic-analysis/bison-grammar.y"
+
+	// No-terminales
+	Program *program;
+	ContractDefinition *contract_definition;
+	ContractBlock *contract_block;
+	FunctionBlock *function_block;
+	Conditional *conditional;
+	ContractInstructions *contract_instructions;
+	ContractInstruction *contract_instruction;
+	FunctionInstructions *function_instructions;
+	FunctionInstruction *function_instruction;
+	Loop *loop;
+	LoopInitialization *loop_initialization;
+	LoopCondition *loop_condition;
+	LoopIteration *loop_iteration;
+	Assignable *assignable;
+	Assignment *assignment;
+	MathAssignment *math_assignment;
+	MathAssignmentOperator *math_assignment_operator;
+	FunctionCall *function_call;
+	Arguments *arguments;
+	MemberCall *member_call;
+	VariableDefinition *variable_definition;
+	DataType *data_type;
+	FunctionDefinition *function_definition;
+	Decorators *decorators;
+	ParameterDefinition *parameter_definition;
+	Parameters *parameters;
+	Expression *expression;
+	Factor *factor;
+	Constant *constant;
+	
+	// Terminales
+	token token;
+	int integer;
+	char *string;
+	Number *number;
+
+#line 166 "../src/frontend/syntactic-analysis/bison-parser.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int yyparse (yyscan_t scanner, CompilerState *state);
+
+/* "%code provides" blocks.  */
+#line 17 "../src/frontend/syntactic-analysis/bison-grammar.y"
+
+	// Analizador léxico reentrante generado por Flex.
+	int yylex(YYSTYPE *semanticValue, yyscan_t scanner);
+
+#line 185 "../src/frontend/syntactic-analysis/bison-parser.h"
+
+#endif /* !YY_YY_SRC_FRONTEND_SYNTACTIC_ANALYSIS_BISON_PARSER_H_INCLUDED  */
@@ -1,118 +1,426 @@
+#include <getopt.h>
+#include <stdarg.h>
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
-#include "backend/code-generation/generator.h"
 #include "backend/support/logger.h"
 #include "backend/support/shared.h"
-#include "backend/semantic-analysis/symbol-table.h"
-#include "frontend/syntactic-analysis/bison-parser.h"
+#include "cache.h"
+#include "compiler.h"
+#include "server.h"
+
+#define USAGE "\nUsage: %s [-o output_file] [-i indent_size] [-t] [-m] [-j jobs] [-l manifest_file] [--connect socket] [--cache-dir directory] [--cache-stats] [--stats stats_file] [input_file...]\n       %s --serve socket [-j jobs]\n"
 
 extern char *optarg; // avoid IDE warnings
+extern int optind;
 
-// Application state
-CompilerState state;
+// Input files given on the command line and/or listed in a manifest
+typedef struct {
+	char **files;
+	int count;
+	int capacity;
+	boolean fromManifest;
+} InputList;
 
-// Code generation options
-FILE *outputFile = NULL;
-int indentationSize = 4;
-boolean indentUsingSpaces = true;
-boolean indentOutput = true;
+// What a compilation unit cost, reported with --stats
+typedef struct {
+	boolean cached;
+	CompilationStatistics statistics;
+} UnitStatistics;
 
-void parseCliOptions(int argc, char *argv[], char *outFileName);
-void freeResources();
+// Batch compilation shared by the worker threads
+typedef struct {
+	InputList *inputs;
+	int *results;
+	UnitStatistics *units;
+	int nextInput;
+	pthread_mutex_t lock;
+} BatchJob;
 
-const int main(int argumentCount, char *arguments[]) {
-	// Initialize the application state
-	state.program = NULL;
-	state.succeed = false;
-	state.symbolTable = NULL;
+// Number of worker threads used in batch mode (-j)
+static int jobs = 1;
 
-	char outFileName[256] = "out.sol";
-	parseCliOptions(argumentCount, arguments, outFileName);
+// Code generation options (shared by every compilation unit)
+static CompilerOptions options = DEFAULT_COMPILER_OPTIONS;
 
-	LogInfo("Compiling...\n");
+// Socket of the compiler server to serve (--serve) or to send every unit to (--connect)
+static const char *serveSocket = NULL;
+static const char *connectSocket = NULL;
 
-	const int result = yyparse(); // reads from stdin, see `script/start.sh`
+// On-disk cache of generated programs (--cache-dir), and whether to report its use (--cache-stats)
+static CompilationCache cache = { NULL, 0, 0 };
+static boolean showCacheStatistics = false;
 
-	switch (result) {
-		case 0:
-			if (state.succeed) {
-				LogInfo("Compilation successful.");
+// JSON report with the time and counters of every phase (--stats)
+static const char *statisticsFileName = NULL;
 
-				// Create or overwrite output file
-				outputFile = fopen(outFileName, "w");
-                if (outputFile == NULL) {
-                    perror("Error opening output file");
-                    exit(EXIT_FAILURE);
-                }
+static const struct option longOptions[] = {
+	{ "serve", required_argument, NULL, 'S' },
+	{ "connect", required_argument, NULL, 'C' },
+	{ "cache-dir", required_argument, NULL, 'D' },
+	{ "cache-stats", no_argument, NULL, 'T' },
+	{ "stats", required_argument, NULL, 'P' },
+	{ NULL, 0, NULL, 0 }
+};
 
-				Generator();
+void parseCliOptions(int argc, char *argv[], char *outFileName, InputList *inputs);
+static int compileToFile(const char *inFileName, const char *outFileName, UnitStatistics *unit);
+static boolean readSource(const char *inFileName, OutputBuffer *source);
+static void logDiagnostics(CompilationResult *result);
+static void addInput(InputList *inputs, const char *file);
+static void readManifest(InputList *inputs, const char *manifestFileName);
+static char *batchOutputFileName(const char *inFileName);
+static void *batchWorker(void *job);
+static int compileBatch(InputList *inputs);
+static void writeStatistics(InputList *inputs, const int *results, const UnitStatistics *units, int count, uint64_t start);
 
-				fclose(outputFile);
-			}
-			else {
-				LogError("Found %d compilation errors:", state.errorCount);
-				for (int i = 0; i < state.errorCount; ++i) {
-					LogErrorRaw("%s\n", state.errors[i]);
-					free(state.errors[i]);
-				}
-				freeResources();
-				return -1;
-			}
-			break;
-		case 1:
-			LogError("[Bison] Syntax error.");
-			break;
-		case 2:
-			LogError("[Bison] Out of memory.");
-			break;
-		default:
-			LogError("[Bison] Unknown error (code %d).", result);
+const int main(int argumentCount, char *arguments[]) {
+	char outFileName[256] = "out.sol";
+	InputList inputs = { NULL, 0, 0, false };
+	parseCliOptions(argumentCount, arguments, outFileName, &inputs);
+
+	const uint64_t start = monotonicNanoseconds();
+	int result;
+	if (serveSocket != NULL) {
+		result = serve(serveSocket, jobs);
+	}
+	else if (inputs.count > 1 || inputs.fromManifest) {
+		result = compileBatch(&inputs);
 	}
+	else {
+		// Without an input file (or with "-") the program is read from stdin
+		const char *inFileName = inputs.count == 1 && strcmp(inputs.files[0], "-") != 0 ? inputs.files[0] : NULL;
+		// A single unit spreads its functions over the jobs instead
+		options.jobs = jobs;
+		UnitStatistics unit = { false };
+		result = compileToFile(inFileName, outFileName, &unit);
+		if (statisticsFileName != NULL) writeStatistics(&inputs, &result, &unit, 1, start);
+	}
+
+	closeCache(&cache);
+	if (showCacheStatistics && serveSocket == NULL) logCacheStatistics(&cache);
 
-	LogInfo("Freeing up memory...");
+	for (int i = 0; i < inputs.count; ++i) free(inputs.files[i]);
+	free(inputs.files);
 
-	freeResources();
-	
 	return result;
 }
 
-void parseCliOptions(int argc, char *argv[], char *outFileName) {
+void parseCliOptions(int argc, char *argv[], char *outFileName, InputList *inputs) {
 	int opt;
 
-    while ((opt = getopt(argc, argv, "o:i:tmh")) != -1) {
+    while ((opt = getopt_long(argc, argv, "o:i:tmj:l:h", longOptions, NULL)) != -1) {
         switch (opt) {
             case 'o':
 				strcpy(outFileName, optarg);
                 break;
             case 'i':
-                indentationSize = atoi(optarg);
+                options.indentationSize = atoi(optarg);
                 break;
             case 't':
-                indentUsingSpaces = false;
+                options.indentUsingSpaces = false;
                 break;
             case 'm':
-                indentOutput = false;
+                options.indentOutput = false;
                 break;
+			case 'j':
+				// -j 0 uses every online processor
+				jobs = atoi(optarg);
+				if (jobs <= 0) jobs = (int) sysconf(_SC_NPROCESSORS_ONLN);
+				if (jobs <= 0) jobs = 1;
+				break;
+			case 'l':
+				readManifest(inputs, optarg);
+				break;
+			case 'S':
+				serveSocket = optarg;
+				break;
+			case 'C':
+				connectSocket = optarg;
+				break;
+			case 'D':
+				if (!openCache(&cache, optarg)) exit(EXIT_FAILURE);
+				break;
+			case 'T':
+				showCacheStatistics = true;
+				break;
+			case 'P':
+				statisticsFileName = optarg;
+				options.collectStatistics = true;
+				break;
 			case 'h':
-				printf("\nUsage: %s [-o output_file] [-i indent_size] [-t] [-m]\n", argv[0]);
+				printf(USAGE, argv[0], argv[0]);
 				exit(EXIT_SUCCESS);
             case '?':
-                fprintf(stderr, "\nUsage: %s [-o output_file] [-i indent_size] [-t] [-m]\n", argv[0]);
+                fprintf(stderr, USAGE, argv[0], argv[0]);
                 exit(EXIT_FAILURE);
         }
     }
 
+	for (int i = optind; i < argc; ++i) addInput(inputs, argv[i]);
+
+	// The options of a server come with each request
+	if (serveSocket != NULL) return;
+
 	// Print out the options
 	LogInfo("Compiler Options:");
-	LogRaw("- Output File: %s\n", optarg);
-    LogRaw("- Indent Size: %d\n", indentationSize);
-    LogRaw("- Indent with: %s\n", indentUsingSpaces ? "spaces" : "tabs");
-    LogRaw("- Indent Output: %s\n", indentOutput ? "true" : "false");
+	if (inputs->count > 1 || inputs->fromManifest) {
+		LogRaw("- Input Files: %d (batch mode)\n", inputs->count);
+		LogRaw("- Jobs: %d\n", jobs);
+	}
+	else {
+		LogRaw("- Input File: %s\n", inputs->count == 0 ? "stdin" : inputs->files[0]);
+		LogRaw("- Output File: %s\n", outFileName);
+		if (jobs > 1) LogRaw("- Jobs: %d\n", jobs);
+	}
+	if (cache.directory != NULL) LogRaw("- Cache Directory: %s\n", cache.directory);
+	if (statisticsFileName != NULL) LogRaw("- Statistics File: %s\n", statisticsFileName);
+    LogRaw("- Indent Size: %d\n", options.indentationSize);
+    LogRaw("- Indent with: %s\n", options.indentUsingSpaces ? "spaces" : "tabs");
+    LogRaw("- Indent Output: %s\n", options.indentOutput ? "true" : "false");
 	LogRaw("\n");
 }
 
-void freeResources() {
-	freeSymbolTable();
-	freeAST(state.program);
+/**
+ * Compiles "inFileName" (or stdin, if NULL) with the library and writes the
+ * generated program to "outFileName". Returns the status of the compilation.
+ */
+static int compileToFile(const char *inFileName, const char *outFileName, UnitStatistics *unit) {
+	LogInfo("Compiling...\n");
+
+	CompilationResult result;
+	int status;
+	if (cache.directory == NULL && connectSocket == NULL) {
+		status = compileFile(inFileName, &options, &result);
+	}
+	else {
+		// The cache key and the server both need the whole source in memory
+		OutputBuffer source;
+		initOutputBuffer(&source);
+		if (!readSource(inFileName, &source)) {
+			freeOutputBuffer(&source);
+			return EXIT_FAILURE;
+		}
+
+		CacheKey key;
+		if (cache.directory != NULL) {
+			key = computeCacheKey(source.data, source.length, &options);
+			if (restoreCachedOutput(&cache, &key, outFileName)) {
+				LogInfo("Compilation successful (cached).");
+				unit->cached = true;
+				freeOutputBuffer(&source);
+				return 0;
+			}
+		}
+
+		status = connectSocket != NULL
+			? compileRemotely(connectSocket, source.data, source.length, &options, &result)
+			: compileBuffer(source.data, source.length, &options, &result);
+		freeOutputBuffer(&source);
+
+		if (cache.directory != NULL && status == 0) storeCachedOutput(&cache, &key, result.output, result.outputLength);
+	}
+	if (status == COMPILATION_INPUT_ERROR) {
+		freeCompilationResult(&result);
+		return EXIT_FAILURE;
+	}
+	unit->statistics = result.statistics;
+	logDiagnostics(&result);
+
+	if (result.status == 0) {
+		LogInfo("Compilation successful.");
+
+		// Create or overwrite output file, with a single write for the whole program
+		FILE *outputFile = fopen(outFileName, "w");
+		if (outputFile == NULL) {
+			perror("Error opening output file");
+			freeCompilationResult(&result);
+			return EXIT_FAILURE;
+		}
+		fwrite(result.output, sizeof(char), result.outputLength, outputFile);
+		fclose(outputFile);
+	}
+
+	freeCompilationResult(&result);
+	return status;
+}
+
+static boolean readSource(const char *inFileName, OutputBuffer *source) {
+	FILE *input = inFileName == NULL ? stdin : fopen(inFileName, "rb");
+	if (input == NULL) {
+		perror("Error opening input file");
+		return false;
+	}
+
+	char chunk[64 * 1024];
+	size_t count;
+	while ((count = fread(chunk, 1, sizeof(chunk), input)) > 0) appendToBuffer(source, chunk, count);
+	boolean succeed = !ferror(input);
+	if (input != stdin) fclose(input);
+	return succeed;
+}
+
+static void logDiagnostics(CompilationResult *result) {
+	OutputBuffer text;
+	initOutputBuffer(&text);
+	formatDiagnostics(result, &text);
+	if (text.length > 0) LogErrorRaw("%s", text.data);
+	freeOutputBuffer(&text);
+}
+
+static void addInput(InputList *inputs, const char *file) {
+	if (inputs->count == inputs->capacity) {
+		inputs->capacity = inputs->capacity == 0 ? 16 : 2 * inputs->capacity;
+		inputs->files = realloc(inputs->files, inputs->capacity * sizeof(char *));
+	}
+	inputs->files[inputs->count++] = strdup(file);
+}
+
+// One input file per line. Empty lines and lines starting with '#' are ignored.
+static void readManifest(InputList *inputs, const char *manifestFileName) {
+	FILE *manifest = fopen(manifestFileName, "r");
+	if (manifest == NULL) {
+		perror("Error opening manifest file");
+		exit(EXIT_FAILURE);
+	}
+
+	char line[4096];
+	while (fgets(line, sizeof(line), manifest) != NULL) {
+		size_t length = strcspn(line, "\r\n");
+		line[length] = '\0';
+		if (length == 0 || line[0] == '#') continue;
+		addInput(inputs, line);
+	}
+
+	fclose(manifest);
+	inputs->fromManifest = true;
+}
+
+// "dir/name.ext" is compiled to "dir/name.sol" (never over the input itself)
+static char *batchOutputFileName(const char *inFileName) {
+	size_t length = strlen(inFileName);
+	const char *extension = strrchr(inFileName, '.');
+	const char *separator = strrchr(inFileName, '/');
+	if (extension != NULL && extension > (separator == NULL ? inFileName : separator + 1) && strcmp(extension, ".sol") != 0)
+		length = extension - inFileName;
+
+	char *outFileName = malloc(length + sizeof(".sol"));
+	memcpy(outFileName, inFileName, length);
+	strcpy(outFileName + length, ".sol");
+	return outFileName;
+}
+
+// Takes the next pending input until none is left. Each result is stored at
+// the index of its input, so the summary does not depend on the scheduling.
+static void *batchWorker(void *job) {
+	BatchJob *batch = job;
+	InputList *inputs = batch->inputs;
+
+	while (true) {
+		pthread_mutex_lock(&batch->lock);
+		const int i = batch->nextInput++;
+		pthread_mutex_unlock(&batch->lock);
+		if (i >= inputs->count) break;
+
+		char *outFileName = batchOutputFileName(inputs->files[i]);
+		LogInfo("[%d/%d] %s -> %s", i + 1, inputs->count, inputs->files[i], outFileName);
+		batch->results[i] = compileToFile(inputs->files[i], outFileName, &batch->units[i]);
+		free(outFileName);
+	}
+
+	return NULL;
+}
+
+static int compileBatch(InputList *inputs) {
+	const uint64_t start = monotonicNanoseconds();
+	BatchJob batch = { inputs, malloc(inputs->count * sizeof(int)), calloc(inputs->count, sizeof(UnitStatistics)), 0 };
+	pthread_mutex_init(&batch.lock, NULL);
+
+	int workerCount = jobs < inputs->count ? jobs : inputs->count;
+	if (workerCount == 1) workerCount = 0;
+	pthread_t *workers = malloc(workerCount * sizeof(pthread_t));
+	int started = 0;
+	for (; started < workerCount; ++started) {
+		if (pthread_create(&workers[started], NULL, batchWorker, &batch) != 0) break;
+	}
+	// A single job (or no worker at all) runs the batch in this thread
+	if (started == 0) batchWorker(&batch);
+	for (int i = 0; i < started; ++i) pthread_join(workers[i], NULL);
+
+	free(workers);
+	pthread_mutex_destroy(&batch.lock);
+
+	int *results = batch.results;
+	int failed = 0;
+	for (int i = 0; i < inputs->count; ++i) {
+		if (results[i] != 0) ++failed;
+	}
+
+	LogInfo("Batch summary: %d compiled, %d succeeded, %d failed.", inputs->count, inputs->count - failed, failed);
+	for (int i = 0; i < inputs->count; ++i) {
+		if (results[i] == 0) LogRaw("- %s: ok\n", inputs->files[i]);
+		else LogRaw("- %s: failed (status %d)\n", inputs->files[i], results[i]);
+	}
+	if (statisticsFileName != NULL) writeStatistics(inputs, results, batch.units, inputs->count, start);
+
+	free(results);
+	free(batch.units);
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static void appendJson(OutputBuffer *json, const char *format, ...) {
+	va_list arguments;
+	va_start(arguments, format);
+	appendFormatToBuffer(json, format, arguments);
+	va_end(arguments);
+}
+
+static void appendJsonString(OutputBuffer *json, const char *string) {
+	appendToBuffer(json, "\"", 1);
+	for (const char *c = string; *c != '\0'; ++c) {
+		if (*c == '"' || *c == '\\') appendJson(json, "\\%c", *c);
+		else if ((unsigned char) *c < 0x20) appendJson(json, "\\u%04x", *c);
+		else appendToBuffer(json, c, 1);
+	}
+	appendToBuffer(json, "\"", 1);
+}
+
+/**
+ * Writes the --stats report: the statistics of every unit, in input order,
+ * and their sum. "start" is the time at which the compilation started.
+ */
+static void writeStatistics(InputList *inputs, const int *results, const UnitStatistics *units, int count, uint64_t start) {
+	const double seconds = (monotonicNanoseconds() - start) / 1e9;
+	CompilationStatistics total;
+	memset(&total, 0, sizeof(total));
+	int cached = 0;
+
+	OutputBuffer json;
+	initOutputBuffer(&json);
+	appendJson(&json, "{\n  \"units\": [");
+	for (int i = 0; i < count; ++i) {
+		appendJson(&json, "%s\n    {\"input\": ", i == 0 ? "" : ",");
+		appendJsonString(&json, inputs->count == 0 ? "-" : inputs->files[i]);
+		appendJson(&json, ", \"status\": %d, \"cached\": %s, \"statistics\": ", results[i], units[i].cached ? "true" : "false");
+		appendStatisticsJson(&units[i].statistics, &json);
+		appendJson(&json, "}");
+		addStatistics(&total, &units[i].statistics);
+		if (units[i].cached) ++cached;
+	}
+	appendJson(&json, "\n  ],\n  \"total\": {\"units\": %d, \"cached\": %d, \"jobs\": %d, \"seconds\": %.9f, \"statistics\": ", count, cached, jobs, seconds);
+	appendStatisticsJson(&total, &json);
+	appendJson(&json, "}\n}\n");
+
+	FILE *statisticsFile = fopen(statisticsFileName, "w");
+	if (statisticsFile == NULL) {
+		perror("Error opening statistics file");
+	}
+	else {
+		fwrite(json.data, sizeof(char), json.length, statisticsFile);
+		fclose(statisticsFile);
+	}
+	freeOutputBuffer(&json);
 }
@@ -0,0 +1,276 @@
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "backend/support/logger.h"
+#include "server.h"
+
+/**
+ * Implementación de "server.h".
+ */
+
+#define SERVER_MAGIC 0x534f4c31 // "SOL1"
+#define SERVER_BACKLOG 64
+
+// A client that stops sending (or receiving) for this long loses its connection, and frees its worker
+#define SERVER_TIMEOUT_SECONDS 10
+
+// Largest indentation a request may ask for (the generator repeats it on every level)
+#define SERVER_MAX_INDENTATION_SIZE 64
+
+typedef struct {
+	uint32_t magic;
+	int32_t indentationSize;
+	uint8_t indentUsingSpaces;
+	uint8_t indentOutput;
+	uint8_t collectStatistics;
+	uint64_t sourceLength;
+} ServerRequest;
+
+typedef struct {
+	int32_t status;
+	int32_t diagnosticCount;
+	uint64_t outputLength;
+} ServerResponse;
+
+typedef struct {
+	int32_t type;
+	int32_t line;
+	uint32_t messageLength;
+	int32_t lexemeLength; // -1 if the diagnostic has no lexeme
+} ServerDiagnostic;
+
+// Path of the socket being served, removed when the server is stopped
+static const char *servedSocketPath = NULL;
+
+static boolean readFully(int fd, void *data, size_t length) {
+	char *bytes = data;
+	while (length > 0) {
+		ssize_t count = read(fd, bytes, length);
+		if (count < 0 && errno == EINTR) continue;
+		if (count <= 0) return false;
+		bytes += count;
+		length -= count;
+	}
+	return true;
+}
+
+static boolean writeFully(int fd, const void *data, size_t length) {
+	const char *bytes = data;
+	while (length > 0) {
+		ssize_t count = send(fd, bytes, length, MSG_NOSIGNAL); // a closed peer must not raise SIGPIPE
+		if (count < 0 && errno == EINTR) continue;
+		if (count <= 0) return false;
+		bytes += count;
+		length -= count;
+	}
+	return true;
+}
+
+static boolean fillSocketAddress(struct sockaddr_un *address, const char *socketPath) {
+	memset(address, 0, sizeof(struct sockaddr_un));
+	address->sun_family = AF_UNIX;
+	if (strlen(socketPath) >= sizeof(address->sun_path)) {
+		LogError("Socket path too long: '%s'.", socketPath);
+		return false;
+	}
+	strcpy(address->sun_path, socketPath);
+	return true;
+}
+
+/* ------------------------------------------------------------------------- */
+/* Server                                                                    */
+/* ------------------------------------------------------------------------- */
+
+static boolean sendResult(int fd, const CompilationResult *result, boolean withStatistics) {
+	ServerResponse response = { result->status, result->diagnosticCount, result->outputLength };
+	if (!writeFully(fd, &response, sizeof(response))) return false;
+	if (result->outputLength > 0 && !writeFully(fd, result->output, result->outputLength)) return false;
+	if (withStatistics && !writeFully(fd, &result->statistics, sizeof(CompilationStatistics))) return false;
+
+	for (int i = 0; i < result->diagnosticCount; ++i) {
+		const Diagnostic *error = &result->diagnostics[i];
+		ServerDiagnostic diagnostic = {
+			error->type,
+			error->line,
+			strlen(error->message),
+			error->lexeme == NULL ? -1 : (int32_t) strlen(error->lexeme)
+		};
+		if (!writeFully(fd, &diagnostic, sizeof(diagnostic))) return false;
+		if (!writeFully(fd, error->message, diagnostic.messageLength)) return false;
+		if (diagnostic.lexemeLength > 0 && !writeFully(fd, error->lexeme, diagnostic.lexemeLength)) return false;
+	}
+	return true;
+}
+
+// Serves a single request. The source buffer is kept (and grown) across requests.
+static void serveConnection(int fd, CompilerSession *session, char **source, size_t *capacity) {
+	ServerRequest request;
+	if (!readFully(fd, &request, sizeof(request)) || request.magic != SERVER_MAGIC) return;
+	if (request.indentationSize < 0 || request.indentationSize > SERVER_MAX_INDENTATION_SIZE) return;
+
+	if (request.sourceLength > *capacity) {
+		char *grown = realloc(*source, request.sourceLength);
+		if (grown == NULL) return;
+		*source = grown;
+		*capacity = request.sourceLength;
+	}
+	if (!readFully(fd, *source, request.sourceLength)) return;
+
+	// Each worker of the server compiles a whole unit, so its functions use a single thread
+	CompilerOptions options = { request.indentationSize, request.indentUsingSpaces, request.indentOutput, request.collectStatistics, 1 };
+	CompilationResult result;
+	compileBufferInSession(session, *source, request.sourceLength, &options, &result);
+	sendResult(fd, &result, options.collectStatistics);
+	freeCompilationResult(&result);
+}
+
+// Every worker accepts connections on the same socket, with its own session.
+static void *serverWorker(void *listener) {
+	const int listenerFd = *(int *) listener;
+	CompilerSession *session = createCompilerSession();
+	char *source = NULL;
+	size_t capacity = 0;
+
+	while (true) {
+		int fd = accept(listenerFd, NULL, NULL);
+		if (fd < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) continue;
+			perror("Error accepting connection");
+			break;
+		}
+		const struct timeval timeout = { SERVER_TIMEOUT_SECONDS, 0 };
+		if (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0
+				&& setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) == 0)
+			serveConnection(fd, session, &source, &capacity);
+		close(fd);
+	}
+
+	free(source);
+	freeCompilerSession(session);
+	return NULL;
+}
+
+static void stopServer(int signalNumber) {
+	(void) signalNumber;
+	if (servedSocketPath != NULL) unlink(servedSocketPath);
+	_exit(EXIT_SUCCESS);
+}
+
+int serve(const char *socketPath, int workers) {
+	struct sockaddr_un address;
+	if (!fillSocketAddress(&address, socketPath)) return EXIT_FAILURE;
+
+	// Replace the socket left behind by a previous server, if any
+	struct stat status;
+	if (stat(socketPath, &status) == 0 && S_ISSOCK(status.st_mode)) unlink(socketPath);
+
+	int listenerFd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listenerFd < 0 || bind(listenerFd, (struct sockaddr *) &address, sizeof(address)) < 0 || listen(listenerFd, SERVER_BACKLOG) < 0) {
+		perror("Error opening server socket");
+		if (listenerFd >= 0) close(listenerFd);
+		return EXIT_FAILURE;
+	}
+
+	servedSocketPath = socketPath;
+	signal(SIGINT, stopServer);
+	signal(SIGTERM, stopServer);
+
+	LogInfo("Serving compilations on '%s' with %d worker(s).", socketPath, workers);
+	fflush(stdout);
+
+	pthread_t *threads = malloc(workers * sizeof(pthread_t));
+	int started = 0;
+	for (; started < workers; ++started) {
+		if (pthread_create(&threads[started], NULL, serverWorker, &listenerFd) != 0) break;
+	}
+	if (started == 0) serverWorker(&listenerFd);
+	for (int i = 0; i < started; ++i) pthread_join(threads[i], NULL);
+
+	free(threads);
+	close(listenerFd);
+	unlink(socketPath);
+	return EXIT_FAILURE;
+}
+
+/* ------------------------------------------------------------------------- */
+/* Client                                                                    */
+/* ------------------------------------------------------------------------- */
+
+static boolean receiveResult(int fd, CompilationResult *result, boolean withStatistics) {
+	ServerResponse response;
+	if (!readFully(fd, &response, sizeof(response))) return false;
+	result->status = response.status;
+
+	if (response.outputLength > 0) {
+		result->output = malloc(response.outputLength + 1);
+		if (result->output == NULL || !readFully(fd, result->output, response.outputLength)) return false;
+		result->output[response.outputLength] = '\0';
+		result->outputLength = response.outputLength;
+	}
+	if (withStatistics && !readFully(fd, &result->statistics, sizeof(CompilationStatistics))) return false;
+
+	if (response.diagnosticCount > 0) {
+		result->diagnostics = calloc(response.diagnosticCount, sizeof(Diagnostic));
+		if (result->diagnostics == NULL) return false;
+	}
+	for (int i = 0; i < response.diagnosticCount; ++i) {
+		ServerDiagnostic diagnostic;
+		if (!readFully(fd, &diagnostic, sizeof(diagnostic))) return false;
+
+		Diagnostic *error = &result->diagnostics[i];
+		result->diagnosticCount = i + 1;
+		error->type = diagnostic.type;
+		error->line = diagnostic.line;
+		error->message = calloc(diagnostic.messageLength + 1, sizeof(char));
+		if (error->message == NULL || !readFully(fd, error->message, diagnostic.messageLength)) return false;
+		if (diagnostic.lexemeLength >= 0) {
+			error->lexeme = calloc(diagnostic.lexemeLength + 1, sizeof(char));
+			if (error->lexeme == NULL || !readFully(fd, error->lexeme, diagnostic.lexemeLength)) return false;
+		}
+	}
+	return true;
+}
+
+int compileRemotely(const char *socketPath, const char *source, size_t length, const CompilerOptions *options, CompilationResult *result) {
+	memset(result, 0, sizeof(CompilationResult));
+	result->status = COMPILATION_INPUT_ERROR;
+
+	struct sockaddr_un address;
+	int fd = -1;
+	if (fillSocketAddress(&address, socketPath)) fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0 || connect(fd, (struct sockaddr *) &address, sizeof(address)) < 0) {
+		perror("Error connecting to the compiler server");
+		if (fd >= 0) close(fd);
+		return result->status;
+	}
+
+	ServerRequest request = {
+		SERVER_MAGIC,
+		options->indentationSize,
+		options->indentUsingSpaces,
+		options->indentOutput,
+		options->collectStatistics,
+		length
+	};
+	boolean succeed = writeFully(fd, &request, sizeof(request))
+		&& writeFully(fd, source, length)
+		&& receiveResult(fd, result, options->collectStatistics);
+	close(fd);
+
+	if (!succeed) {
+		LogError("The compiler server did not answer.");
+		freeCompilationResult(result);
+		result->status = COMPILATION_INPUT_ERROR;
+	}
+	return result->status;
+}
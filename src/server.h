@@ -0,0 +1,29 @@
+#ifndef SERVER_HEADER
+#define SERVER_HEADER
+
+#include "compiler.h"
+
+/**
+ * Modo servidor: el compilador queda residente y atiende compilaciones que
+ * llegan por un socket Unix local, evitando el costo de iniciar un proceso por
+ * cada una. Cada worker conserva su sesión (arena y tabla de strings) entre
+ * pedidos.
+ *
+ * Protocolo (en el orden de bytes de la máquina, ya que el socket es local):
+ *
+ *	pedido:    ServerRequest, seguido de "sourceLength" bytes de código fuente.
+ *	respuesta: ServerResponse, seguido de "outputLength" bytes de Solidity, de
+ *	           las estadísticas (si el pedido las solicita) y de "diagnosticCount"
+ *	           errores (ServerDiagnostic, mensaje y lexema).
+ */
+
+// Atiende pedidos en "socketPath" con "workers" hilos. Solo retorna ante un error.
+int serve(const char *socketPath, int workers);
+
+/**
+ * Compila los "length" bytes de "source" en el servidor que escucha en
+ * "socketPath". El resultado es el mismo que el de "compileBuffer".
+ */
+int compileRemotely(const char *socketPath, const char *source, size_t length, const CompilerOptions *options, CompilationResult *result);
+
+#endif
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.0;
+
+import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+
+contract Folding is ReentrancyGuard {
+    uint fee = 1024000000000000000;
+    
+    int delta = -13;
+    
+    uint[] slots = new uint[](8);
+    
+    bool ready = true;
+    
+    function pay(address to, uint amount) internal {
+        uint half = amount / 2;
+        (bool s, ) = address(to).call{value: 250000000000000000}("");
+        require(s, "ETH transfer failed");
+    }
+}
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.0;
+
+import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+
+contract Toggles is ReentrancyGuard {
+    uint counter;
+    
+    bool debug;
+    
+    event Logged(uint value);
+    
+    function run(uint amount) internal {
+        counter = 2;
+        if (true) {
+            uint scoped = amount;
+            counter += scoped;
+        }
+        if (!debug) {
+            counter--;
+        }
+    }
+}
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.0;
+
+import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+
+contract Payroll is ReentrancyGuard {
+    uint employees;
+    
+    uint total;
+    
+    uint[] salaries = new uint[](64);
+    
+    function pay(uint rounds) internal {
+        {
+            uint employees$cached = employees;
+            for (uint i = 0; i < employees$cached; ) {
+                total += salaries[i];
+                unchecked { ++i; }
+            }
+        }
+        for (uint j = rounds * 2; j > 0; ) {
+            total++;
+            unchecked { --j; }
+        }
+        for (uint k = 0; k < employees; ) {
+            employees--;
+            unchecked { ++k; }
+        }
+        for (int n = 10; n > -10; ) {
+            total += 1;
+            unchecked { --n; }
+        }
+        for (uint m = 0; m < rounds; m++) {
+            m += 1;
+        }
+        {
+            uint q$bound = rounds * 2;
+            for (uint q = 0; q < q$bound; ) {
+                for (uint r = 0; r < q; ) {
+                    total += r;
+                    unchecked { ++r; }
+                }
+                unchecked { ++q; }
+            }
+        }
+        for (uint s = 0; s < rounds + 1; ) {
+            rounds--;
+            unchecked { ++s; }
+        }
+        for (uint p = 0; p <= rounds; p++) {
+            total += p;
+        }
+        for (uint u = 0; rounds > u; u--) {
+            total += u;
+        }
+        for (uint v = 0; rounds > v; v++) {
+            v += 1;
+        }
+    }
+    
+    function shrink(uint[] memory sizes) internal {
+        sizes[0] = sizes[0] - 1;
+    }
+    
+    function resize() internal {
+        uint[] memory sizes = new uint[](4);
+        sizes[0] = 10;
+        for (uint i = 0; i < sizes[0] + 1; ) {
+            shrink(sizes);
+            unchecked { ++i; }
+        }
+        uint[] memory other = new uint[](4);
+        other = sizes;
+        for (uint j = 0; j < sizes[0] + 1; ) {
+            other[0] = 0;
+            unchecked { ++j; }
+        }
+        {
+            uint k$bound = sizes[1] * 2;
+            for (uint k = 0; k < k$bound; ) {
+                total += k;
+                unchecked { ++k; }
+            }
+        }
+    }
+}
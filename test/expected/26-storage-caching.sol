@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.0;
+
+import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+import "@openzeppelin/contracts/token/ERC20/IERC20.sol";
+import "forge-std/console.sol";
+
+contract Rewards is ReentrancyGuard {
+    uint rate = 5;
+    
+    uint bonus;
+    
+    uint paid;
+    
+    bool paused;
+    
+    IERC20 token;
+    
+    event Paid(uint amount);
+    
+    function accrue(uint periods) internal {
+        uint rate$cached = rate;
+        uint bonus$cached = bonus;
+        if (paused) {
+            console.log("Paused");
+        }
+        for (uint i = 0; i < periods; ) {
+            paid += rate$cached * i + bonus$cached;
+            unchecked { ++i; }
+        }
+        emit Paid(paid);
+    }
+    
+    function reset(uint periods) internal {
+        uint rate$cached = rate;
+        bonus = 0;
+        for (uint i = 0; i < periods; ) {
+            paid += rate$cached;
+            unchecked { ++i; }
+        }
+        bonus = rate$cached;
+    }
+    
+    function rebase(uint periods) internal {
+        {
+            uint bonus$cached = bonus;
+            for (uint i = 0; i < periods; ) {
+                paid += bonus$cached;
+                unchecked { ++i; }
+            }
+        }
+        bonus = paid;
+    }
+    
+    function sweep() internal {
+        paid = rate;
+        reset(rate);
+        paid += rate;
+    }
+    
+    function payout(address to) internal {
+        for (uint i = 0; i < rate; ) {
+            token.transfer(to, bonus);
+            unchecked { ++i; }
+        }
+    }
+}
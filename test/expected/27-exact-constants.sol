@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: MIT
+pragma solidity ^0.8.0;
+
+import "@openzeppelin/contracts/utils/ReentrancyGuard.sol";
+
+contract Exact is ReentrancyGuard {
+    uint a = (7 / 2) * 2;
+    
+    uint b = 3 - 5 + 10;
+    
+    uint c = 2 ** 256 - 1;
+    
+    uint d = 5;
+    
+    function check(uint amount) internal {
+        bool whole = amount > (9 / 2) * 2;
+    }
+}